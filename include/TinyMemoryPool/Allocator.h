@@ -1,18 +1,34 @@
 #pragma once
 
 #include "Detail/MemoryApi.h"
+#include "ThreadingPolicy.h"
 
 #include <cstddef>
 #include <limits>
+#include <memory>
 #include <new>
 #include <type_traits>
 
 namespace TinyMemoryPool
 {
 
+#if defined(__cpp_lib_allocate_at_least)
+template <typename Pointer>
+using AllocationResult = std::allocation_result<Pointer>;
+#else
+/// @brief C++23 std::allocation_result ü Ÿ (C++20 ȯ).
+template <typename Pointer>
+struct AllocationResult
+{
+    Pointer ptr;
+    std::size_t count;
+};
+#endif
+
 /// @brief STL ȣȯ Ŀ Allocator.
-//  PoolManager  ޸𸮸 Ҵ/Ѵ.
-template <typename T>
+//  ThreadingPolicy    ޸𸮸 Ҵ/Ѵ.
+// ⺻(MultiThreaded)  PoolManager, SingleThreaded ȣ    .
+template <typename T, typename ThreadingPolicy = MultiThreaded>
 class Allocator
 {
   public:
@@ -25,7 +41,8 @@ class Allocator
     Allocator(const Allocator&) noexcept = default;
 
     template <typename U>
-    Allocator(const Allocator<U>&) noexcept
+    Allocator(const Allocator<U, ThreadingPolicy>& other) noexcept
+        : mThreadChecker(other.mThreadChecker)
     {
     }
 
@@ -33,12 +50,14 @@ class Allocator
 
     [[nodiscard]] T* allocate(std::size_t n)
     {
+        mThreadChecker.Check();
+
         if(n > std::numeric_limits<std::size_t>::max() / sizeof(T))
         {
             throw std::bad_array_new_length();
         }
 
-        void* ptr = Detail::EngineAllocate(n * sizeof(T));
+        void* ptr = ThreadingPolicy::Allocate(n * sizeof(T));
 
         if(ptr == nullptr) [[unlikely]]
         {
@@ -48,28 +67,70 @@ class Allocator
         return static_cast<T*>(ptr);
     }
 
+    /// @brief ּ n Ҵϰ, ûũ ũ Ŭ       Բ ȯѴ (C++23 Ÿ).
+    [[nodiscard]] AllocationResult<T*> allocate_at_least(std::size_t n)
+    {
+        mThreadChecker.Check();
+
+        if(n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+
+        std::size_t usableSize = 0;
+        void* ptr = ThreadingPolicy::AllocateAtLeast(n * sizeof(T), usableSize);
+
+        if(ptr == nullptr) [[unlikely]]
+        {
+            throw std::bad_alloc();
+        }
+
+        return {static_cast<T*>(ptr), usableSize / sizeof(T)};
+    }
+
     void deallocate(T* p, std::size_t n) noexcept
     {
-        Detail::EngineDeallocate(p, n * sizeof(T));
+        mThreadChecker.Check();
+
+        ThreadingPolicy::Deallocate(p, n * sizeof(T));
     }
 
     template <typename U>
     struct rebind
     {
-        using other = Allocator<U>;
+        using other = Allocator<U, ThreadingPolicy>;
     };
+
+  private:
+    template <typename U, typename OtherPolicy>
+    friend class Allocator;
+
+    [[no_unique_address]] typename ThreadingPolicy::ThreadChecker mThreadChecker;
 };
 
-template <typename T, typename U>
-bool operator==(const Allocator<T>&, const Allocator<U>&) noexcept
+template <typename T, typename U, typename ThreadingPolicy>
+bool operator==(const Allocator<T, ThreadingPolicy>&, const Allocator<U, ThreadingPolicy>&) noexcept
 {
     return true;
 }
 
-template <typename T, typename U>
-bool operator!=(const Allocator<T>&, const Allocator<U>&) noexcept
+template <typename T, typename U, typename ThreadingPolicy>
+bool operator!=(const Allocator<T, ThreadingPolicy>&, const Allocator<U, ThreadingPolicy>&) noexcept
 {
     return false;
 }
 
+/// @brief å ٸ  ޸𸮸   .
+template <typename T, typename U, typename PolicyA, typename PolicyB>
+bool operator==(const Allocator<T, PolicyA>&, const Allocator<U, PolicyB>&) noexcept
+{
+    return false;
+}
+
+template <typename T, typename U, typename PolicyA, typename PolicyB>
+bool operator!=(const Allocator<T, PolicyA>&, const Allocator<U, PolicyB>&) noexcept
+{
+    return true;
+}
+
 } // namespace TinyMemoryPool
@@ -18,7 +18,10 @@ struct PoolConfig
 /// @brief MemoryManager ü ʱȭ .
 struct MemoryManagerConfig
 {
+    /// @brief  ϳ  ũ. Ǹ  ũ  ߰ Ѵ.
     std::size_t TotalReserveSize = 1024 * 1024 * 1024;
+    /// @brief    ũ .  Ҵ nullptr(Allocator std::bad_alloc) Ѵ.
+    std::size_t MaxReserveSize = std::size_t{64} * 1024 * 1024 * 1024;
     std::size_t FrameAllocatorSize = 16 * 1024 * 1024;
     std::vector<PoolConfig> PoolConfigs;
 };
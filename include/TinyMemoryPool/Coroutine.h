@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Detail/MemoryApi.h"
+
+#include <cstddef>
+#include <new>
+
+namespace TinyMemoryPool
+{
+
+/// @brief ڷƾ  PoolManager ҴѴ. promise_type::operator new ȣѴ.
+/// @note  ̴  ũ(1KB ) 庰 ĳÿ ȰǾ PoolManager ġ ʴ´.
+[[nodiscard]] inline void* AllocateCoroutineFrame(std::size_t size)
+{
+    void* ptr = Detail::EngineAllocateFrame(size);
+
+    if(ptr == nullptr) [[unlikely]]
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+/// @brief ڷƾ  . Ϸ sized delete Ѱִ  ũ⸦ ״ ؾ Ѵ.
+inline void DeallocateCoroutineFrame(void* ptr, std::size_t size) noexcept
+{
+    Detail::EngineDeallocateFrame(ptr, size);
+}
+
+/// @brief ڷƾ  Ҵ PoolManager  promise_type ͽ.
+/// @code
+/// struct Task
+/// {
+///     struct promise_type : TinyMemoryPool::PooledPromise
+///     {
+///         ...
+///     };
+/// };
+/// @endcode
+struct PooledPromise
+{
+    [[nodiscard]] static void* operator new(std::size_t size)
+    {
+        return AllocateCoroutineFrame(size);
+    }
+
+    static void operator delete(void* ptr, std::size_t size) noexcept
+    {
+        DeallocateCoroutineFrame(ptr, size);
+    }
+};
+
+} // namespace TinyMemoryPool
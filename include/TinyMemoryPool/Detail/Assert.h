@@ -0,0 +1,16 @@
+#pragma once
+
+/// @name TinyMemoryPool Assert Macro
+///   ζ ˻翡   ֵ  Common.h и д.
+/// {@
+
+#if !defined(NDEBUG) || defined(_DEBUG)
+#include <cassert>
+#define TMP_ASSERT_ENABLED 1
+#define TMP_ASSERT(condition) assert(condition)
+#else
+#define TMP_ASSERT_ENABLED 0
+#define TMP_ASSERT(condition) ((void) 0)
+#endif
+
+/// @}
@@ -1,14 +1,70 @@
 #pragma once
 
+#include "../Config.h"
+
 #include <cstddef>
 
 namespace TinyMemoryPool::Detail
 {
 
+/// @brief ù Ҵ   ( ũ TotalReserveSize,   MaxReserveSize) Ѵ.
+/// @return ̹  ϱ      false (  ).
+/// @note PoolConfigs, FrameAllocatorSize   ʴ´.
+[[nodiscard]] bool EngineConfigure(const MemoryManagerConfig& config);
+
 /// @brief PoolManager ̱ Ǵ Ҵ 긴 Լ.
 /// @note LTO(Link Time Optimization)   ̳ʸ ζ óȴ.
 [[nodiscard]] void* EngineAllocate(std::size_t size);
 
+/// @brief ּ size Ʈ Ҵϰ,    ũ⸦ usableSize ش.
+/// @note ûũ ũ Ŭ    ũ̹Ƿ usableSize >= size ȴ.
+[[nodiscard]] void* EngineAllocateAtLeast(std::size_t size, std::size_t& usableSize);
+
+/// @brief hint  Span(ϸ  ) ġǵ õϴ Ҵ.
+/// @param hint   Ҵ޾    ּ, Ǵ nullptr.  ּҿ  ʰ Ѵ.
+/// @note ġ û ּ (best effort)̸, Ʈ  Ŭ ƴϸ(⺻  ) EngineAllocate ϴ.
+[[nodiscard]] void* EngineAllocateNear(std::size_t size, const void* hint);
+
 void EngineDeallocate(void* ptr, std::size_t size);
 
+/// @brief  Ҵ newSize Ѵ. ϸ ڸ Ȯ/ϰ, ƴϸ ̵  Ѵ.
+/// @param ptr EngineAllocate 迭  ּ. EngineAllocateLocal ޸𸮴   ѱ  .
+/// @return  ּ.   nullptr̸  Ҵ ȿϰ ´.
+[[nodiscard]] void* EngineReallocate(void* ptr, std::size_t newSize);
+
+/// @brief ּ ̵  Ҵ newSize Ȯ õѴ. EngineAllocateLocal ޸𸮴 ѱ  .
+/// @return   Ȯ    ũ,   0.
+[[nodiscard]] std::size_t EngineTryExpand(void* ptr, std::size_t newSize);
+
+/// @brief ڷƾ   Ҵ.  ̴  ũ 庰 ĳÿ ȰѴ.
+[[nodiscard]] void* EngineAllocateFrame(std::size_t size);
+
+/// @brief ڷƾ  . size Ϸ sized delete Ѱִ  ũ⿩ Ѵ.
+void EngineDeallocateFrame(void* ptr, std::size_t size);
+
+/// @brief ȣ   (SingleThreaded å) ҴѴ.  /  ʴ´.
+/// @note   ũ Ŭθ ϹǷ    size Ѱܾ Ѵ.
+///   Retire, Reallocate, TryExpand, GetUsableSize ѱ   ( 忡 TMP_ASSERT).
+[[nodiscard]] void* EngineAllocateLocal(std::size_t size);
+
+/// @brief EngineAllocateLocal , ũ Ŭ    ũ⸦ usableSize ش.
+[[nodiscard]] void* EngineAllocateLocalAtLeast(std::size_t size, std::size_t& usableSize);
+
+void EngineDeallocateLocal(void* ptr, std::size_t size);
+
+/// @brief ũ Ӱ  /Ż. ø ȣ Ѵ.
+void EngineEnterEpoch();
+void EngineExitEpoch();
+
+/// @brief ٸ 尡  а   ִ Ҵ  ũ  ̷.
+/// @note EngineAllocateLocal ޸𸮴 ѱ  .
+void EngineRetire(void* ptr, std::size_t size);
+
+/// @brief ũ  ȸ  õѴ.
+/// @return  忡  ȸ ʰ  ִ Ҵ .
+std::size_t EngineTryReclaim();
+
+/// @brief Ҵ ּ ̵    ִ  ũ (Byte). EngineAllocateLocal ޸𸮴 ѱ  .
+[[nodiscard]] std::size_t EngineGetUsableSize(const void* ptr);
+
 } // namespace TinyMemoryPool::Detail
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Detail/MemoryApi.h"
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace TinyMemoryPool
+{
+
+/// @brief  ü  Span(ϸ  )  ġϴ STL ȣȯ Allocator. Ʈ  Ŭ .
+/// allocate(n, hint) θ 带 ѱ  ó, hint   νϽ  Ҵ  ó ġѴ.
+/// std::map/std::listó 带 ϳ Ҵϴ ̳ʿ ȸ  ĳ/TLB ߷ δ.
+/// @warning ⺻ (TMP_BITMAP_POOL_MASK=0) hint õǾ Allocator<T>  .
+/// ġ ȿ   ũ Ŭ TMP_BITMAP_POOL_MASK Ʈ  ؾ Ѵ.
+/// @note ޸𸮴 Allocator<T>  ȣȯȴ. ̹  hint  ʰ Ϲ Ҵ üѴ.
+template <typename T>
+class LocalityAllocator
+{
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using is_always_equal = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type; ///<  Ҵ ġ  Բ ̵ϵ.
+    using propagate_on_container_swap = std::true_type;
+
+    LocalityAllocator() noexcept = default;
+    LocalityAllocator(const LocalityAllocator&) noexcept = default;
+
+    /// @brief rebind  Allocator ٸ Ÿ 带 ҴϹǷ  Ҵ ġ ̾ ʴ´.
+    template <typename U>
+    LocalityAllocator(const LocalityAllocator<U>&) noexcept
+    {
+    }
+
+    ~LocalityAllocator() noexcept = default;
+
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        return allocate(n, mLastAllocation);
+    }
+
+    /// @param hint ó ġ  ü ( θ ).   Ҵ޾     ȿ ִ.
+    [[nodiscard]] T* allocate(std::size_t n, const void* hint)
+    {
+        if(n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+
+        void* ptr = Detail::EngineAllocateNear(n * sizeof(T), hint);
+
+        if(ptr == nullptr) [[unlikely]]
+        {
+            throw std::bad_alloc();
+        }
+
+        mLastAllocation = ptr;
+        return static_cast<T*>(ptr);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        //  ּҸ hint  ʵ 
+        if(p == mLastAllocation)
+            mLastAllocation = nullptr;
+
+        Detail::EngineDeallocate(p, n * sizeof(T));
+    }
+
+    /// @brief ̳    ̳ 带 hint   ʵ  νϽ ش.
+    [[nodiscard]] LocalityAllocator select_on_container_copy_construction() const noexcept
+    {
+        return LocalityAllocator();
+    }
+
+    template <typename U>
+    struct rebind
+    {
+        using other = LocalityAllocator<U>;
+    };
+
+  private:
+    const void* mLastAllocation = nullptr;
+};
+
+template <typename T, typename U>
+bool operator==(const LocalityAllocator<T>&, const LocalityAllocator<U>&) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const LocalityAllocator<T>&, const LocalityAllocator<U>&) noexcept
+{
+    return false;
+}
+
+} // namespace TinyMemoryPool
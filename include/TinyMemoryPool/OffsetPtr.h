@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TinyMemoryPool
+{
+
+/// @brief ڱ ڽ ּҸ   Ÿ ϴ .
+///   (PersistentHeap )  ü  ٸ ּҿ εǾ ״ ȿϴ.
+/// @note Ÿ 0 nullptr ǹϹǷ ڱ ڽ ų  .
+template <typename T>
+class OffsetPtr
+{
+  public:
+    OffsetPtr() noexcept = default;
+
+    OffsetPtr(T* ptr) noexcept
+    {
+        Set(ptr);
+    }
+
+    OffsetPtr(const OffsetPtr& other) noexcept
+    {
+        Set(other.Get());
+    }
+
+    OffsetPtr& operator=(const OffsetPtr& other) noexcept
+    {
+        Set(other.Get());
+        return *this;
+    }
+
+    OffsetPtr& operator=(T* ptr) noexcept
+    {
+        Set(ptr);
+        return *this;
+    }
+
+    [[nodiscard]] T* Get() const noexcept
+    {
+        if(mOffset == 0)
+            return nullptr;
+
+        return reinterpret_cast<T*>(reinterpret_cast<std::intptr_t>(this) + mOffset);
+    }
+
+    T& operator*() const noexcept
+    {
+        return *Get();
+    }
+
+    T* operator->() const noexcept
+    {
+        return Get();
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return mOffset != 0;
+    }
+
+  private:
+    void Set(T* ptr) noexcept
+    {
+        mOffset = (ptr == nullptr) ? 0 : reinterpret_cast<std::intptr_t>(ptr) - reinterpret_cast<std::intptr_t>(this);
+    }
+
+  private:
+    std::intptr_t mOffset = 0;
+};
+
+} // namespace TinyMemoryPool
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace TinyMemoryPool
+{
+
+namespace Detail
+{
+class RegionHeap;
+}
+
+/// @brief PersistentHeap::Open/Create  .
+enum class PersistentHeapError : std::uint8_t
+{
+    None,
+    AlreadyOpen,
+    MapFailed,          ///<  ų  .
+    NotAHeap,           ///<       .   ʴ´.
+    UnsupportedVersion, ///<  尡      .   ʴ´.
+};
+
+/// @brief Ͽ ε  .     ٽ  Free List Ʈ ü ״ ȴ.
+/// @note      ǹǷ  ٸ ּҿ εǾ(Relocation) Ѵ.
+///  ü ʹ OffsetPtr<T> ؾ  Ŀ ȿϴ.
+class PersistentHeap final
+{
+  public:
+    PersistentHeap();
+    ~PersistentHeap();
+
+    PersistentHeap(const PersistentHeap&) = delete;
+    PersistentHeap& operator=(const PersistentHeap&) = delete;
+
+    /// @brief  ( ) ϰ  ¸ Ѵ.
+    ///  ̳  ϸ  ϸ,  ִ     ǵ帮 ʰ Ѵ.
+    /// @param path   .
+    /// @param size ּ ũ (Byte).     ø.
+    /// @param preferredBase   ּ. nullptr̸ Ͽ ϵ  ּҸ õѴ.
+    /// @return  .   GetLastError ȮѴ.
+    bool Open(const std::string& path, std::size_t size, void* preferredBase = nullptr);
+
+    /// @brief       Ͽ  ( ).
+    /// @note    ͵  .   ʴ  ٽ    Ѵ.
+    bool Create(const std::string& path, std::size_t size, void* preferredBase = nullptr);
+
+    /// @brief   ũ ϰ  Ѵ.
+    void Close() noexcept;
+
+    /// @brief   ũ ȭѴ.
+    void Flush() noexcept;
+
+    [[nodiscard]] bool IsOpen() const noexcept;
+
+    /// @brief Open    ¸ ߴ  (false  ˵).
+    [[nodiscard]] bool IsRecovered() const noexcept;
+
+    /// @brief Open   ٸ ּҿ εǾ .
+    [[nodiscard]] bool IsRelocated() const noexcept;
+
+    /// @brief  Open/Create  .  None.
+    [[nodiscard]] PersistentHeapError GetLastError() const noexcept;
+
+    /// @brief  ޸𸮸 ҴѴ (Thread-Safe).
+    /// @return ȿ ּ.   ϸ nullptr.
+    [[nodiscard]] void* Allocate(std::size_t size);
+
+    void Deallocate(void* ptr);
+
+    /// @brief   ã  ֵ   ϵǴ Ʈ ü.
+    [[nodiscard]] void* GetRoot() const noexcept;
+    void SetRoot(void* ptr) noexcept;
+
+    [[nodiscard]] std::uint64_t ToOffset(const void* ptr) const noexcept;
+    [[nodiscard]] void* FromOffset(std::uint64_t offset) const noexcept;
+
+  private:
+    bool Map(const std::string& path, std::size_t size, void* preferredBase, bool format);
+
+  private:
+    std::unique_ptr<Detail::RegionHeap> mHeap;
+
+    void* mBaseAddress = nullptr;
+    std::size_t mMappedSize = 0;
+
+    bool mIsRecovered = false;
+    bool mIsRelocated = false;
+    PersistentHeapError mLastError = PersistentHeapError::None;
+};
+
+} // namespace TinyMemoryPool
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Detail/MemoryApi.h"
+
+#include <cstddef>
+
+namespace TinyMemoryPool
+{
+
+/// @brief ũ Ӱ   RAII . Lock-Free   带 д  Ѵ.
+/// 尡  ִ  ٸ 尡 Retire  ȸ ʴ´. øؼ  ȴ.
+/// @code
+/// {
+///     TinyMemoryPool::EpochGuard guard;
+///     Node* head = mHead.load(std::memory_order_acquire);
+///     ... // head ϰ 
+/// }
+/// @endcode
+class EpochGuard
+{
+  public:
+    EpochGuard()
+    {
+        Detail::EngineEnterEpoch();
+    }
+
+    ~EpochGuard()
+    {
+        Detail::EngineExitEpoch();
+    }
+
+    EpochGuard(const EpochGuard&) = delete;
+    EpochGuard& operator=(const EpochGuard&) = delete;
+};
+
+/// @brief     Ҵ  ̷. deallocate  ȣѴ.
+/// 庰  ׿ٰ,  尡  ũ Ѿ Pool ϰ ݳȴ.
+/// @param ptr Allocator    Ҵ ּ. SingleThreaded å ޸𸮴   ѱ  .
+/// @param size Ҵ ũ (Byte). deallocate ϰ Ʈ̽ Ͽ δ.
+inline void Retire(void* ptr, std::size_t size)
+{
+    Detail::EngineRetire(ptr, size);
+}
+
+/// @brief ũ  ȸ  õѴ (  , ׽Ʈ ).
+/// @return  尡 Retire  ȸ  Ҵ . Ӱ  ӹ 尡  0 ƴ  ִ.
+inline std::size_t TryReclaim()
+{
+    return Detail::EngineTryReclaim();
+}
+
+} // namespace TinyMemoryPool
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace TinyMemoryPool
+{
+
+namespace Detail
+{
+class RegionHeap;
+}
+
+/// @brief μ      Ҵ ĺ.
+///  μ   ٸ ּҿ ϹǷ      ְ޴´.
+struct SharedHandle
+{
+    std::uint64_t Offset = 0; ///< 0̸ nullptr.
+
+    [[nodiscard]] explicit operator bool() const noexcept
+    {
+        return Offset != 0;
+    }
+};
+
+/// @brief  μ  ̸ Ͽ Բ ϴ  ޸ .
+/// ڰ Ҵ ޽ SharedHandle ѱ, Һڴ   а     ִ.
+/// @note Ҵ/   Lock-Free Free List óǾ μ  ϴ.
+class SharedHeap final
+{
+  public:
+    SharedHeap();
+    ~SharedHeap();
+
+    SharedHeap(const SharedHeap&) = delete;
+    SharedHeap& operator=(const SharedHeap&) = delete;
+
+    /// @brief   ޸  ϰ Ѵ.  ̸ ̹  Ѵ.
+    /// @param name  ޸ ̸ (POSIX: "/name").
+    /// @param size  ũ (Byte).
+    bool Create(const std::string& name, std::size_t size);
+
+    /// @brief ٸ μ   ޸  .
+    bool Open(const std::string& name);
+
+    /// @brief  μ  Ѵ.  ü Unlink  ȴ.
+    void Close() noexcept;
+
+    /// @brief  ޸ ̸ Ѵ. ̹  ִ     ִ.
+    static bool Unlink(const std::string& name) noexcept;
+
+    [[nodiscard]] bool IsOpen() const noexcept;
+
+    /// @brief   ޸𸮸 ҴѴ (Lock-Free, Process-Shared).
+    /// @return ȿ ּ.   á nullptr.
+    [[nodiscard]] void* Allocate(std::size_t size);
+
+    /// @brief  μ Ҵߵ   ޸𸮸 Ѵ.
+    void Deallocate(void* ptr);
+
+    void Deallocate(SharedHandle handle);
+
+    [[nodiscard]] SharedHandle ToHandle(const void* ptr) const noexcept;
+    [[nodiscard]] void* FromHandle(SharedHandle handle) const noexcept;
+
+  private:
+    bool Attach(void* base, std::size_t size, bool format);
+
+  private:
+    std::unique_ptr<Detail::RegionHeap> mHeap;
+
+    void* mBaseAddress = nullptr;
+    std::size_t mMappedSize = 0;
+};
+
+} // namespace TinyMemoryPool
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Detail/Assert.h"
+#include "Detail/MemoryApi.h"
+
+#include <cstddef>
+#include <new>
+#include <thread>
+
+namespace TinyMemoryPool
+{
+
+/// @brief ⺻  å.  尡 ϴ PoolManager Ѵ (Thread-Safe).
+struct MultiThreaded
+{
+    /// @brief  忡 ᵵ ǹǷ ˻ ʴ´.
+    struct ThreadChecker
+    {
+        void Check() const noexcept
+        {
+        }
+    };
+
+    [[nodiscard]] static void* Allocate(std::size_t size)
+    {
+        return Detail::EngineAllocate(size);
+    }
+
+    [[nodiscard]] static void* AllocateAtLeast(std::size_t size, std::size_t& usableSize)
+    {
+        return Detail::EngineAllocateAtLeast(size, usableSize);
+    }
+
+    static void Deallocate(void* ptr, std::size_t size) noexcept
+    {
+        Detail::EngineDeallocate(ptr, size);
+    }
+};
+
+/// @brief   å. ȣ    Intrusive Free List ϸ,  / .
+///   , ھ  Ŀó   ȿ Ҵ/ϴ ýۿ̴.
+/// @note Ҵ 忡 ؾ Ѵ.  忡  ܰ ˻Ѵ.
+/// Allocator νϽ  带  ٸ 忡  TMP_ASSERT ,
+///   ڽ  ûũ  Heap<SingleThreaded>    ٸ   ´.
+/// @warning ûũ տ BlockHeader Ƿ  å  ޸𸮴 Retire, EngineReallocate, EngineTryExpand,
+/// EngineGetUsableSize ѱ   ( 忡 TMP_ASSERT). LocalityAllocator hint ѱ õȴ.
+struct SingleThreaded
+{
+    /// @note    ̾ƿ  ϵ Owner ׻ ΰ, ˻縸  忡 Ѵ.
+    struct ThreadChecker
+    {
+        void Check() const noexcept
+        {
+            TMP_ASSERT(Owner == std::this_thread::get_id() && "SingleThreaded allocator used from another thread.");
+        }
+
+        std::thread::id Owner = std::this_thread::get_id();
+    };
+
+    [[nodiscard]] static void* Allocate(std::size_t size)
+    {
+        return Detail::EngineAllocateLocal(size);
+    }
+
+    [[nodiscard]] static void* AllocateAtLeast(std::size_t size, std::size_t& usableSize)
+    {
+        return Detail::EngineAllocateLocalAtLeast(size, usableSize);
+    }
+
+    static void Deallocate(void* ptr, std::size_t size) noexcept
+    {
+        Detail::EngineDeallocateLocal(ptr, size);
+    }
+};
+
+/// @brief å Ʈ  . STL ̳ʰ ƴ       Ѵ.
+/// @code
+/// void* p = TinyMemoryPool::Heap<TinyMemoryPool::SingleThreaded>::Allocate(48);
+/// TinyMemoryPool::Heap<TinyMemoryPool::SingleThreaded>::Deallocate(p, 48);
+/// @endcode
+/// @note  ÿ Ҵ   size Ѱܾ Ѵ. SingleThreaded Ҵ 忡 ؾ Ѵ.
+template <typename ThreadingPolicy = MultiThreaded>
+struct Heap
+{
+    [[nodiscard]] static void* Allocate(std::size_t size)
+    {
+        void* ptr = ThreadingPolicy::Allocate(size);
+
+        if(ptr == nullptr) [[unlikely]]
+        {
+            throw std::bad_alloc();
+        }
+
+        return ptr;
+    }
+
+    static void Deallocate(void* ptr, std::size_t size) noexcept
+    {
+        ThreadingPolicy::Deallocate(ptr, size);
+    }
+};
+
+} // namespace TinyMemoryPool
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace TinyMemoryPool
+{
+
+/// @brief Ʈ̽ ϵǴ  .
+enum class TraceOp : std::uint8_t
+{
+    Allocate = 0,
+    Deallocate = 1,
+};
+
+/// @brief Ʈ̽  .   տ   ϵȴ.
+struct TraceFileHeader
+{
+    static constexpr std::uint64_t MAGIC = 0x4543415254504D54; ///< "TMPTRACE"
+    static constexpr std::uint32_t VERSION = 1;
+
+    std::uint64_t Magic;
+    std::uint32_t Version;
+    std::uint32_t RecordSize;
+};
+
+/// @brief Ҵ/ 1  (32 Bytes).
+/// @note 庰   ϵǹǷ  ȿ      ִ.   TimestampNs Ѵ.
+struct TraceRecord
+{
+    std::uint64_t TimestampNs; ///< steady_clock  .
+    std::uint64_t Id;          ///< Ҵ ĺ (  ּ).     ִ.
+    std::uint64_t Size;        ///< û ũ (Byte).
+    std::uint32_t ThreadId;    ///<    (0).
+    TraceOp Op;
+    std::uint8_t Reserved[3];
+};
+
+static_assert(sizeof(TraceRecord) == 32, "TraceRecord must stay 32 bytes for the on-disk format.");
+
+/// @brief EngineAllocate/EngineDeallocate ȣ Ϸ ϱ Ѵ.
+/// @note CMake ɼ TMP_ENABLE_TRACE  쿡 ϸ, ׷  ׻ false ȯѴ.
+/// @return   . ̹  ̰ų     false.
+bool StartTraceRecording(const std::string& path);
+
+/// @brief   ۸ Ϸ   Ѵ.
+void StopTraceRecording();
+
+} // namespace TinyMemoryPool
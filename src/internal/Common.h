@@ -1,18 +1,13 @@
 #pragma once
 
+#include <TinyMemoryPool/Detail/Assert.h>
+
 #include <exception>
 #include <iostream>
 
 /// @name TinyMemoryPool Debug Macros
 /// {@
 
-#if !defined(NDEBUG) || defined(_DEBUG)
-#include <cassert>
-#define TMP_ASSERT(condition) assert(condition)
-#else
-#define TMP_ASSERT(condition) ((void) 0)
-#endif
-
 /// @brief  Ұ ġ   α   α׷ Ѵ.
 #define TMP_FATAL_ERROR(message)                                                                                       \
     do                                                                                                                 \
@@ -0,0 +1,263 @@
+#include "EpochManager.h"
+#include "Common.h"
+#include "PoolManager.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace TinyMemoryPool::Detail
+{
+
+/// @brief  ϳ ũ Խ ¿ Retire .
+/// State ٸ (TryAdvance) ,   常 Ѵ.
+class EpochThreadRecord final
+{
+  public:
+    static constexpr std::uint64_t ACTIVE = 1;
+    static constexpr std::size_t BATCH_SIZE = 64; ///< ̸ŭ   ȸ õѴ.
+
+    EpochThreadRecord()
+    {
+        EpochManager::GetInstance().Register(this);
+    }
+
+    ~EpochThreadRecord();
+
+    EpochThreadRecord(const EpochThreadRecord&) = delete;
+    EpochThreadRecord& operator=(const EpochThreadRecord&) = delete;
+
+    std::atomic<std::uint64_t> State = 0; ///< (ũ << 1) | ACTIVE. Ӱ  ̸ 0.
+    std::uint32_t NestDepth = 0;
+
+    RetireBatch Batches[EpochManager::BATCH_COUNT]; ///< ũ % BATCH_COUNT ĭ ״´.
+    std::size_t PendingCount = 0;
+    std::size_t NextCollectCount = BATCH_SIZE;
+};
+
+namespace
+{
+
+/// ڵ尡 Ҹ (ٸ TLS Ҹڿ ȣ)   ֵ Ҹڰ  Ÿ д.
+thread_local bool isThreadRecordDestroyed = false;
+
+[[nodiscard]] EpochThreadRecord* GetThreadRecord()
+{
+    if(isThreadRecordDestroyed) [[unlikely]]
+        return nullptr;
+
+    thread_local std::unique_ptr<EpochThreadRecord> record = std::make_unique<EpochThreadRecord>();
+    return record.get();
+}
+
+} // namespace
+
+EpochThreadRecord::~EpochThreadRecord()
+{
+    isThreadRecordDestroyed = true;
+
+    EpochManager::GetInstance().Unregister(this);
+}
+
+EpochManager& EpochManager::GetInstance()
+{
+    static EpochManager instance;
+    return instance;
+}
+
+EpochManager::EpochManager()
+{
+    //   Ҹڿ ݳϹǷ PoolManager  (߿ Ҹ)ǵ 
+    PoolManager::GetInstance();
+}
+
+EpochManager::~EpochManager()
+{
+    // μ   Ӱ  ִ 尡 Ƿ  ݳ
+    std::lock_guard<std::mutex> lock(mRegistryMutex);
+
+    for(RetireBatch& batch : mOrphanBatches)
+    {
+        ReleaseBatch(batch);
+    }
+    mOrphanBatches.clear();
+}
+
+void EpochManager::Enter()
+{
+    EpochThreadRecord* record = GetThreadRecord();
+    if(record == nullptr) [[unlikely]]
+        return;
+
+    if(record->NestDepth++ == 0)
+    {
+        const std::uint64_t epoch = mGlobalEpoch.load(std::memory_order_relaxed);
+        record->State.store((epoch << 1) | EpochThreadRecord::ACTIVE, std::memory_order_relaxed);
+
+        // Խð    б⺸  ̵ (TryAdvance fence ¦)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+void EpochManager::Exit()
+{
+    EpochThreadRecord* record = GetThreadRecord();
+    if(record == nullptr) [[unlikely]]
+        return;
+
+    TMP_ASSERT(record->NestDepth > 0 && "EpochManager::Exit without Enter.");
+
+    // ¦  Exit ̰ εǸ 尡  Ӱ     ȸ 
+    if(record->NestDepth == 0) [[unlikely]]
+        return;
+
+    if(--record->NestDepth == 0)
+    {
+        record->State.store(0, std::memory_order_release);
+    }
+}
+
+void EpochManager::Retire(void* ptr)
+{
+    if(ptr == nullptr)
+        return;
+
+    EpochThreadRecord* record = GetThreadRecord();
+    const std::uint64_t epoch = mGlobalEpoch.load(std::memory_order_acquire);
+
+    if(record == nullptr) [[unlikely]]
+    {
+        //   ߿   ٷ ѱ
+        std::lock_guard<std::mutex> lock(mRegistryMutex);
+        mOrphanBatches.push_back(RetireBatch{epoch, {ptr}});
+        return;
+    }
+
+    RetireBatch& batch = record->Batches[epoch % BATCH_COUNT];
+    if(batch.Epoch != epoch)
+    {
+        //  ĭ  ִ  ּ 3 ũ  ̹Ƿ ̹ 
+        record->PendingCount -= ReleaseBatch(batch);
+        batch.Epoch = epoch;
+    }
+
+    batch.Blocks.push_back(ptr);
+
+    if(++record->PendingCount >= record->NextCollectCount)
+    {
+        Collect(*record);
+    }
+}
+
+std::size_t EpochManager::TryReclaim()
+{
+    EpochThreadRecord* record = GetThreadRecord();
+    if(record == nullptr) [[unlikely]]
+        return 0;
+
+    //   Retire κ 2 ũ  ʿ
+    for(std::size_t i = 0; i < BATCH_COUNT - 1; ++i)
+    {
+        if(!TryAdvance())
+            break;
+    }
+
+    Collect(*record);
+
+    return record->PendingCount;
+}
+
+void EpochManager::Register(EpochThreadRecord* record)
+{
+    std::lock_guard<std::mutex> lock(mRegistryMutex);
+    mRecords.push_back(record);
+}
+
+void EpochManager::Unregister(EpochThreadRecord* record)
+{
+    std::lock_guard<std::mutex> lock(mRegistryMutex);
+
+    mRecords.erase(std::remove(mRecords.begin(), mRecords.end(), record), mRecords.end());
+
+    for(RetireBatch& batch : record->Batches)
+    {
+        if(!batch.Blocks.empty())
+            mOrphanBatches.push_back(std::move(batch));
+    }
+}
+
+bool EpochManager::TryAdvance()
+{
+    std::lock_guard<std::mutex> lock(mRegistryMutex);
+
+    // Retire    ڵ ˻纸  ̵ (Enter fence ¦)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    const std::uint64_t epoch = mGlobalEpoch.load(std::memory_order_relaxed);
+
+    for(const EpochThreadRecord* record : mRecords)
+    {
+        const std::uint64_t state = record->State.load(std::memory_order_relaxed);
+        if((state & EpochThreadRecord::ACTIVE) && (state >> 1) != epoch)
+            return false;
+    }
+
+    //    ȿ ϾǷ CAS ʿ 
+    const std::uint64_t nextEpoch = epoch + 1;
+    mGlobalEpoch.store(nextEpoch, std::memory_order_release);
+
+    auto it = mOrphanBatches.begin();
+    while(it != mOrphanBatches.end())
+    {
+        if(it->Epoch + 2 <= nextEpoch)
+        {
+            ReleaseBatch(*it);
+            it = mOrphanBatches.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return true;
+}
+
+void EpochManager::Collect(EpochThreadRecord& record)
+{
+    (void) TryAdvance();
+
+    const std::uint64_t epoch = mGlobalEpoch.load(std::memory_order_acquire);
+
+    for(RetireBatch& batch : record.Batches)
+    {
+        if(!batch.Blocks.empty() && batch.Epoch + 2 <= epoch)
+            record.PendingCount -= ReleaseBatch(batch);
+    }
+
+    //  ӹ Ӱ   ȸ , Retire   ʵ  õ ̷
+    record.NextCollectCount = record.PendingCount + EpochThreadRecord::BATCH_SIZE;
+}
+
+std::size_t EpochManager::ReleaseBatch(RetireBatch& batch)
+{
+    const std::size_t count = batch.Blocks.size();
+
+    if(count > 0)
+    {
+        PoolManager& manager = PoolManager::GetInstance();
+
+#if TMP_ASSERT_ENABLED
+        // ʹ  ȸ 带 д 尡  (FIFO Free List )  ٷ ˾ç  ֵ 
+        for(void* block : batch.Blocks)
+            std::memset(block, 0xDD, manager.GetUsableSize(block));
+#endif
+
+        manager.DeallocateBatch(batch.Blocks.data(), count);
+        batch.Blocks.clear();
+    }
+
+    return count;
+}
+
+} // namespace TinyMemoryPool::Detail
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace TinyMemoryPool::Detail
+{
+
+class EpochThreadRecord;
+
+/// @brief  ũ Retire Ҵ .
+struct RetireBatch
+{
+    std::uint64_t Epoch = 0;
+    std::vector<void*> Blocks;
+};
+
+/// @brief ũ   ȸ(Epoch-Based Reclamation) .
+/// Ӱ     ũ ڽ ڵ忡 Խϰ, Retire Ҵ 庰  δ.
+///  Ȱ 尡  ũ ϸ  ũ ϸ, 2 ũ  Retire 
+///  嵵   Ƿ PoolManager ϰ ݳѴ.
+/// Meyers Singleton.
+/// @note Retire/Enter/Exit   ¸ Ѵ.     á  ȸ õ .
+class EpochManager final
+{
+  public:
+    static EpochManager& GetInstance();
+
+    /// @brief Ӱ  . ø ȣ Ѵ.
+    void Enter();
+
+    /// @brief Ӱ  Ż.  ٱ Exit ũ Խø Ѵ.
+    void Exit();
+
+    /// @brief Ҵ  ũ  ߰Ѵ.   ̸ ȸ õѴ.
+    void Retire(void* ptr);
+
+    /// @brief ũ  ȸ  õѴ.
+    /// @return  忡   ִ (ȸ ) Ҵ .
+    std::size_t TryReclaim();
+
+  private:
+    friend class EpochThreadRecord;
+
+    EpochManager();
+    ~EpochManager();
+
+    EpochManager(const EpochManager&) = delete;
+    EpochManager& operator=(const EpochManager&) = delete;
+
+    void Register(EpochThreadRecord* record);
+
+    /// @brief ϴ      Ѱ ٸ  ȸ õ óѴ.
+    void Unregister(EpochThreadRecord* record);
+
+    /// @brief  Ȱ 尡  ũ   ũ 1 Ų.
+    bool TryAdvance();
+
+    /// @brief  ũ    ݳѴ.
+    void Collect(EpochThreadRecord& record);
+
+    /// @brief  PoolManager ϰ ݳϰ .
+    /// @return ݳ Ҵ .
+    std::size_t ReleaseBatch(RetireBatch& batch);
+
+  private:
+    static constexpr std::size_t BATCH_COUNT = 3; ///< , ,   ũ.
+
+    std::atomic<std::uint64_t> mGlobalEpoch = 0;
+
+    std::mutex mRegistryMutex; ///< ڵ /, ũ ,   ó (Cold Path).
+    std::vector<EpochThreadRecord*> mRecords;
+    std::vector<RetireBatch> mOrphanBatches;
+};
+
+} // namespace TinyMemoryPool::Detail
@@ -0,0 +1,93 @@
+#include "FrameCache.h"
+#include "PoolManager.h"
+
+namespace TinyMemoryPool::Detail
+{
+
+namespace
+{
+
+/// ĳð Ҹ (ٸ TLS Ҹڿ ȣ)   ֵ Ҹڰ  Ÿ д.
+thread_local bool isThreadCacheDestroyed = false;
+
+} // namespace
+
+[[nodiscard]] FrameCache* FrameCache::GetThreadInstance()
+{
+    if(isThreadCacheDestroyed) [[unlikely]]
+        return nullptr;
+
+    thread_local FrameCache instance;
+    return &instance;
+}
+
+FrameCache::~FrameCache()
+{
+    isThreadCacheDestroyed = true;
+
+    PoolManager& manager = PoolManager::GetInstance();
+
+    for(std::size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        while(mBuckets[i])
+        {
+            FreeFrame* frame = mBuckets[i];
+            mBuckets[i] = frame->Next;
+            manager.Deallocate(frame);
+        }
+        mCounts[i] = 0;
+    }
+}
+
+[[nodiscard]] void* FrameCache::Allocate(std::size_t size)
+{
+    const std::size_t index = GetBucketIndex(size);
+
+    if(index >= BUCKET_COUNT) [[unlikely]]
+        return PoolManager::GetInstance().Allocate(size);
+
+    if(FreeFrame* frame = mBuckets[index])
+    {
+        mBuckets[index] = frame->Next;
+        --mCounts[index];
+        return frame;
+    }
+
+    return PoolManager::GetInstance().Allocate(GetAllocationSize(size));
+}
+
+void FrameCache::Deallocate(void* ptr, std::size_t size)
+{
+    if(ptr == nullptr)
+        return;
+
+    const std::size_t index = GetBucketIndex(size);
+
+    if(index >= BUCKET_COUNT || mCounts[index] >= MAX_FRAMES_PER_BUCKET) [[unlikely]]
+    {
+        PoolManager::GetInstance().Deallocate(ptr);
+        return;
+    }
+
+    auto* frame = static_cast<FreeFrame*>(ptr);
+    frame->Next = mBuckets[index];
+    mBuckets[index] = frame;
+    ++mCounts[index];
+}
+
+[[nodiscard]] std::size_t FrameCache::GetAllocationSize(std::size_t size) noexcept
+{
+    const std::size_t index = GetBucketIndex(size);
+
+    // Ŷ  ũ Ҵ ξ   ĳ÷   Ŷ    ִ.
+    //  BlockHeader   64B  ǵ ,  ũ  Pool Ŭ  Ѵ
+    return (index < BUCKET_COUNT) ? ((index + 1) << BUCKET_SHIFT) - sizeof(BlockHeader) : size;
+}
+
+[[nodiscard]] std::size_t FrameCache::GetBucketIndex(std::size_t size) noexcept
+{
+    // Header  ũ : 1~48B -> 0, 49~112B -> 1, ...
+    return (size == 0) ? 0 : (size + sizeof(BlockHeader) - 1) >> BUCKET_SHIFT;
+}
+
+} // namespace TinyMemoryPool::Detail
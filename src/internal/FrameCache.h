@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+
+namespace TinyMemoryPool::Detail
+{
+
+/// @brief ڷƾ  庰 Ȱϴ ĳ.
+///  ũ⸦ 64B  Ŷ(BlockHeader  ũ ) ,    Ŷ  Ҵ翡 ٷ ش.
+/// ĳð ų   쿡 PoolManager ģ.
+/// @note   ü̹Ƿ  . ٸ 忡     ĳ÷ .
+class FrameCache final
+{
+  public:
+    /// @return   ĳ.    ĳð ̹ Ҹ nullptr (ȣ  PoolManager  ).
+    [[nodiscard]] static FrameCache* GetThreadInstance();
+
+    FrameCache() = default;
+    ~FrameCache();
+
+    FrameCache(const FrameCache&) = delete;
+    FrameCache& operator=(const FrameCache&) = delete;
+
+    [[nodiscard]] void* Allocate(std::size_t size);
+    void Deallocate(void* ptr, std::size_t size);
+
+    /// @brief  PoolManager   ũ (Ŷ ).
+    /// @note   ĳ÷   Ŷ    ֵ, ĳ ۿ Ҵ   ũ⸦ .
+    [[nodiscard]] static std::size_t GetAllocationSize(std::size_t size) noexcept;
+
+  private:
+    struct FreeFrame
+    {
+        FreeFrame* Next;
+    };
+
+    [[nodiscard]] static std::size_t GetBucketIndex(std::size_t size) noexcept;
+
+  private:
+    static constexpr std::size_t BUCKET_SHIFT = 6;         ///< Ŷ  64B.
+    static constexpr std::size_t BUCKET_COUNT = 16;        ///< Header  1KB( 1008B) ĳ.
+    static constexpr std::size_t MAX_FRAMES_PER_BUCKET = 64;
+
+    FreeFrame* mBuckets[BUCKET_COUNT] = {};
+    std::size_t mCounts[BUCKET_COUNT] = {};
+};
+
+} // namespace TinyMemoryPool::Detail
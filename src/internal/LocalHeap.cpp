@@ -0,0 +1,287 @@
+#include "LocalHeap.h"
+#include "Common.h"
+#include "MemoryManager.h"
+#include "PoolManager.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace TinyMemoryPool::Detail
+{
+
+namespace
+{
+
+///  Ҹ (ٸ TLS Ҹڿ ȣ)   ֵ Ҹڰ  Ÿ д.
+thread_local bool isThreadHeapDestroyed = false;
+
+} // namespace
+
+struct LocalHeap::OrphanLists
+{
+    std::mutex Mutex;
+    FreeChunk* Heads[CLASS_COUNT] = {};
+    std::vector<std::pair<std::byte*, std::byte*>> CarveRanges[CLASS_COUNT]; ///<  ߶    .
+    std::vector<std::pair<std::byte*, std::byte*>> Blocks;                   ///<    ( ּ ).
+};
+
+[[nodiscard]] LocalHeap* LocalHeap::GetThreadInstance()
+{
+    if(isThreadHeapDestroyed) [[unlikely]]
+        return nullptr;
+
+    thread_local LocalHeap instance;
+    return &instance;
+}
+
+LocalHeap::LocalHeap()
+{
+    // MemoryManager ʱȭ PoolManager ڰ .  ϰ Բ    (߿ Ҹ)ǵ 
+    PoolManager::GetInstance();
+    (void) GetOrphanLists();
+
+    std::fill(std::begin(mNextBlockSizes), std::end(mNextBlockSizes), INITIAL_BLOCK_SIZE);
+}
+
+LocalHeap::~LocalHeap()
+{
+    isThreadHeapDestroyed = true;
+
+    //  ûũ ڸ   ٸ 尡 ϵ   ѱ
+    OrphanLists& orphans = GetOrphanLists();
+    std::lock_guard<std::mutex> lock(orphans.Mutex);
+
+    for(std::size_t i = 0; i < CLASS_COUNT; ++i)
+    {
+        while(FreeChunk* chunk = mFreeLists[i])
+        {
+            mFreeLists[i] = chunk->Next;
+            chunk->Next = orphans.Heads[i];
+            orphans.Heads[i] = chunk;
+        }
+
+        if(mCarveCursors[i] != mCarveEnds[i])
+            orphans.CarveRanges[i].emplace_back(mCarveCursors[i], mCarveEnds[i]);
+
+        mCarveCursors[i] = mCarveEnds[i] = nullptr;
+    }
+}
+
+[[nodiscard]] void* LocalHeap::Allocate(std::size_t size)
+{
+    if(size > MAX_CHUNK_SIZE) [[unlikely]]
+        return std::malloc(size);
+
+    void* ptr = TakeChunk(GetClassIndex(size));
+
+#if TMP_ASSERT_ENABLED
+    if(ptr != nullptr)
+        mLiveChunks.insert(ptr);
+#endif
+
+    return ptr;
+}
+
+void LocalHeap::Deallocate(void* ptr, std::size_t size)
+{
+    if(ptr == nullptr)
+        return;
+
+    if(size > MAX_CHUNK_SIZE) [[unlikely]]
+    {
+        std::free(ptr);
+        return;
+    }
+
+#if TMP_ASSERT_ENABLED
+    // ٸ 尡 Ҵ ûũ   Free List     ûũ ϰ ȴ
+    const bool isOwnChunk = mLiveChunks.erase(ptr) != 0;
+    TMP_ASSERT(isOwnChunk && "SingleThreaded chunk freed on a thread other than the one that allocated it.");
+#endif
+
+    const std::size_t index = GetClassIndex(size);
+
+    auto* chunk = static_cast<FreeChunk*>(ptr);
+    chunk->Next = mFreeLists[index];
+    mFreeLists[index] = chunk;
+}
+
+[[nodiscard]] void* LocalHeap::TakeChunk(std::size_t index)
+{
+    if(FreeChunk* chunk = mFreeLists[index])
+    {
+        mFreeLists[index] = chunk->Next;
+        return chunk;
+    }
+
+    const std::size_t chunkSize = std::size_t{1} << (index + MIN_BIT_SHIFT);
+
+    if(mCarveCursors[index] == mCarveEnds[index]) [[unlikely]]
+    {
+        if(!Refill(index))
+            return nullptr;
+
+        //  Ͽ ûũ ޾  
+        if(FreeChunk* chunk = mFreeLists[index])
+        {
+            mFreeLists[index] = chunk->Next;
+            return chunk;
+        }
+    }
+
+    void* ptr = mCarveCursors[index];
+    mCarveCursors[index] += chunkSize;
+
+    return ptr;
+}
+
+[[nodiscard]] std::size_t LocalHeap::GetUsableSize(std::size_t size) noexcept
+{
+    if(size > MAX_CHUNK_SIZE)
+        return size;
+
+    return std::size_t{1} << (GetClassIndex(size) + MIN_BIT_SHIFT);
+}
+
+[[nodiscard]] LocalHeap::OrphanLists& LocalHeap::GetOrphanLists()
+{
+    static OrphanLists instance;
+    return instance;
+}
+
+[[nodiscard]] std::size_t LocalHeap::GetClassIndex(std::size_t size) noexcept
+{
+    const std::size_t clampedSize = std::max(size, std::size_t{1} << MIN_BIT_SHIFT);
+
+    // bit_width: C++20 <bit>. κ BSR/LZCNT ϵ ɾ ȯ.
+    return std::bit_width(clampedSize - 1) - MIN_BIT_SHIFT;
+}
+
+[[nodiscard]] bool LocalHeap::Refill(std::size_t index)
+{
+    {
+        OrphanLists& orphans = GetOrphanLists();
+        std::lock_guard<std::mutex> lock(orphans.Mutex);
+
+        if(orphans.Heads[index] != nullptr)
+        {
+            mFreeLists[index] = std::exchange(orphans.Heads[index], nullptr);
+            return true;
+        }
+
+        if(!orphans.CarveRanges[index].empty())
+        {
+            std::tie(mCarveCursors[index], mCarveEnds[index]) = orphans.CarveRanges[index].back();
+            orphans.CarveRanges[index].pop_back();
+            return true;
+        }
+    }
+
+    std::size_t& blockSize = mNextBlockSizes[index];
+
+    void* block = ::TinyMemoryPool::MemoryManager::GetInstance().AllocateBlock(blockSize);
+    if(block == nullptr)
+        return false;
+
+    {
+        OrphanLists& orphans = GetOrphanLists();
+        std::lock_guard<std::mutex> lock(orphans.Mutex);
+        RegisterBlock(orphans, static_cast<std::byte*>(block), blockSize);
+    }
+
+    mCarveCursors[index] = static_cast<std::byte*>(block);
+    mCarveEnds[index] = mCarveCursors[index] + blockSize;
+
+    blockSize = std::min(blockSize * 2, MAX_BLOCK_SIZE);
+
+    return true;
+}
+
+[[nodiscard]] void* LocalHeap::AllocateShared(std::size_t size)
+{
+    if(size > MAX_CHUNK_SIZE) [[unlikely]]
+        return std::malloc(size);
+
+    const std::size_t index = GetClassIndex(size);
+    const std::size_t chunkSize = std::size_t{1} << (index + MIN_BIT_SHIFT);
+
+    OrphanLists& orphans = GetOrphanLists();
+    std::lock_guard<std::mutex> lock(orphans.Mutex);
+
+    if(FreeChunk* chunk = orphans.Heads[index])
+    {
+        orphans.Heads[index] = chunk->Next;
+        return chunk;
+    }
+
+    if(!orphans.CarveRanges[index].empty())
+    {
+        auto& [cursor, end] = orphans.CarveRanges[index].back();
+        void* ptr = cursor;
+        cursor += chunkSize;
+        if(cursor == end)
+            orphans.CarveRanges[index].pop_back();
+        return ptr;
+    }
+
+    //    幮 .    ȣ   Ͽ д
+    auto* block = static_cast<std::byte*>(
+        ::TinyMemoryPool::MemoryManager::GetInstance().AllocateBlock(INITIAL_BLOCK_SIZE));
+    if(block == nullptr)
+        return nullptr;
+
+    RegisterBlock(orphans, block, INITIAL_BLOCK_SIZE);
+    orphans.CarveRanges[index].emplace_back(block + chunkSize, block + INITIAL_BLOCK_SIZE);
+    return block;
+}
+
+void LocalHeap::DeallocateShared(void* ptr, std::size_t size)
+{
+    if(ptr == nullptr)
+        return;
+
+    if(size > MAX_CHUNK_SIZE) [[unlikely]]
+    {
+        std::free(ptr);
+        return;
+    }
+
+    const std::size_t index = GetClassIndex(size);
+
+    OrphanLists& orphans = GetOrphanLists();
+    std::lock_guard<std::mutex> lock(orphans.Mutex);
+
+    auto* chunk = static_cast<FreeChunk*>(ptr);
+    chunk->Next = orphans.Heads[index];
+    orphans.Heads[index] = chunk;
+}
+
+[[nodiscard]] bool LocalHeap::Owns(const void* ptr)
+{
+    const auto* address = static_cast<const std::byte*>(ptr);
+
+    OrphanLists& orphans = GetOrphanLists();
+    std::lock_guard<std::mutex> lock(orphans.Mutex);
+
+    // address Ͽ ϴ   address  Ȯ
+    auto it = std::upper_bound(orphans.Blocks.begin(), orphans.Blocks.end(), address,
+                               [](const std::byte* value, const auto& block) { return value < block.first; });
+    if(it == orphans.Blocks.begin())
+        return false;
+
+    --it;
+    return address < it->second;
+}
+
+void LocalHeap::RegisterBlock(OrphanLists& orphans, std::byte* begin, std::size_t size)
+{
+    const auto block = std::make_pair(begin, begin + size);
+    orphans.Blocks.insert(std::upper_bound(orphans.Blocks.begin(), orphans.Blocks.end(), block), block);
+}
+
+} // namespace TinyMemoryPool::Detail
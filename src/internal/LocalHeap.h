@@ -0,0 +1,88 @@
+#pragma once
+
+#include <TinyMemoryPool/Detail/Assert.h>
+
+#include <cstddef>
+
+#if TMP_ASSERT_ENABLED
+#include <unordered_set>
+#endif
+
+namespace TinyMemoryPool::Detail
+{
+
+/// @brief     (SingleThreaded å ).
+/// ũ Ŭ PoolManager (64B ~ 4KB), Ŭ ûũ ȿ  ͸ δ ܼ Intrusive Free List .
+///   ü̹Ƿ Hot Path  /  . ûũ տ   Ƿ   ũⰡ ʿϴ.
+/// @note  Ȯ(Refill)    ȯ MemoryManager/   ģ.
+/// @warning ûũ BlockHeader Ƿ PoolManager (Retire, Reallocate, TryExpand, GetUsableSize) ѱ  ȴ.
+class LocalHeap final
+{
+  public:
+    /// @return   .     ̹ Ҹ nullptr (ȣ  AllocateShared  ).
+    [[nodiscard]] static LocalHeap* GetThreadInstance();
+
+    LocalHeap();
+    ~LocalHeap();
+
+    LocalHeap(const LocalHeap&) = delete;
+    LocalHeap& operator=(const LocalHeap&) = delete;
+
+    /// @return Ҵ ּ. ޸𸮸 Ȯ ϸ nullptr.
+    [[nodiscard]] void* Allocate(std::size_t size);
+
+    /// @param size Allocate ѱ ũ.  ũ Ŭ   .
+    /// @note  忡     ûũ ƴϸ(ٸ 忡 ) TMP_ASSERT ߴѴ.
+    void Deallocate(void* ptr, std::size_t size);
+
+    /// @brief size û    ִ ũ (ũ Ŭ ûũ ũ).
+    [[nodiscard]] static std::size_t GetUsableSize(std::size_t size) noexcept;
+
+    /// @brief   ( Ҹ ) ȣ .   װ óѴ.
+    [[nodiscard]] static void* AllocateShared(std::size_t size);
+    static void DeallocateShared(void* ptr, std::size_t size);
+
+    /// @brief ptr LocalHeap   ȿ ִ ˻Ѵ (  , ܿ).
+    [[nodiscard]] static bool Owns(const void* ptr);
+
+  private:
+    struct FreeChunk
+    {
+        FreeChunk* Next;
+    };
+
+    /// @brief  尡  ûũ ũ Ŭ  δ  ϰ   (Cold Path, ؽ ȣ).
+    struct OrphanLists;
+    [[nodiscard]] static OrphanLists& GetOrphanLists();
+
+    [[nodiscard]] static std::size_t GetClassIndex(std::size_t size) noexcept;
+
+    /// @brief ũ Ŭ Free List ,  ߶   ûũ ϳ ߶ .
+    [[nodiscard]] void* TakeChunk(std::size_t index);
+
+    /// @brief   ûũ 켱 ,  MemoryManager   ޾ ߶   д.
+    [[nodiscard]] bool Refill(std::size_t index);
+
+    /// @brief MemoryManager   Owns ˻ Ͽ ִ´.     ¿ ȣ.
+    static void RegisterBlock(OrphanLists& orphans, std::byte* begin, std::size_t size);
+
+  private:
+    static constexpr std::size_t MIN_BIT_SHIFT = 6;            ///< ּ ûũ 64B = 2^6.
+    static constexpr std::size_t MAX_CHUNK_SIZE = 4096;        ///<  ũ ʰ  System Malloc fallback.
+    static constexpr std::size_t CLASS_COUNT = 7;              ///< 64, 128, 256, 512, 1024, 2048, 4096.
+    static constexpr std::size_t INITIAL_BLOCK_SIZE = 64 * 1024;
+    static constexpr std::size_t MAX_BLOCK_SIZE = 1024 * 1024; ///< 庰   ũ 2辿 ø.
+
+    FreeChunk* mFreeLists[CLASS_COUNT] = {};
+
+    //   ̸  ʰ ʿ  տ ߶  ( Ѳ ǵ帮 )
+    std::byte* mCarveCursors[CLASS_COUNT] = {};
+    std::byte* mCarveEnds[CLASS_COUNT] = {};
+    std::size_t mNextBlockSizes[CLASS_COUNT] = {};
+
+#if TMP_ASSERT_ENABLED
+    std::unordered_set<void*> mLiveChunks; ///<   ְ    ûũ (ٸ   ).
+#endif
+};
+
+} // namespace TinyMemoryPool::Detail
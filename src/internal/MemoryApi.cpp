@@ -1,18 +1,170 @@
 #include <TinyMemoryPool/Detail/MemoryApi.h>
 
+#include "EpochManager.h"
+#include "FrameCache.h"
+#include "LocalHeap.h"
 #include "PoolManager.h"
+#include "TraceRecorder.h"
 
 namespace TinyMemoryPool::Detail
 {
 
+bool EngineConfigure(const MemoryManagerConfig& config)
+{
+    return PoolManager::Configure(config);
+}
+
 void* EngineAllocate(std::size_t size)
 {
-    return PoolManager::GetInstance().Allocate(size);
+    void* ptr = PoolManager::GetInstance().Allocate(size);
+    TMP_TRACE_RECORD(TraceOp::Allocate, ptr, size);
+
+    return ptr;
+}
+
+void* EngineAllocateAtLeast(std::size_t size, std::size_t& usableSize)
+{
+    PoolManager& manager = PoolManager::GetInstance();
+
+    void* ptr = manager.Allocate(size);
+    usableSize = (ptr != nullptr) ? manager.GetUsableSize(ptr) : 0;
+    TMP_TRACE_RECORD(TraceOp::Allocate, ptr, size);
+
+    return ptr;
+}
+
+void* EngineAllocateNear(std::size_t size, const void* hint)
+{
+    void* ptr = PoolManager::GetInstance().AllocateNear(size, hint);
+    TMP_TRACE_RECORD(TraceOp::Allocate, ptr, size);
+
+    return ptr;
 }
 
 void EngineDeallocate(void* ptr, [[maybe_unused]] std::size_t size)
 {
+    //   ٸ 尡  ּҸ   Ƿ   
+    TMP_TRACE_RECORD(TraceOp::Deallocate, ptr, size);
     PoolManager::GetInstance().Deallocate(ptr);
 }
 
+void* EngineReallocate(void* ptr, std::size_t newSize)
+{
+    TMP_ASSERT(!LocalHeap::Owns(ptr) && "SingleThreaded heap memory has no block header.");
+
+#if TMP_ENABLE_TRACE
+    // Ʈ̽  + Ҵ   (  realloc ̵   )
+    if(ptr != nullptr)
+        TMP_TRACE_RECORD(TraceOp::Deallocate, ptr, 0);
+
+    void* newPtr = PoolManager::GetInstance().Reallocate(ptr, newSize);
+
+    if(newPtr != nullptr)
+        TMP_TRACE_RECORD(TraceOp::Allocate, newPtr, newSize);
+
+    return newPtr;
+#else
+    return PoolManager::GetInstance().Reallocate(ptr, newSize);
+#endif
+}
+
+void* EngineAllocateFrame(std::size_t size)
+{
+    FrameCache* cache = FrameCache::GetThreadInstance();
+
+    //   (ĳ Ҹ ) ĳø ġ ʴ´. ٸ  ĳ÷   Ƿ ũ  д
+    void* ptr = cache ? cache->Allocate(size)
+                      : PoolManager::GetInstance().Allocate(FrameCache::GetAllocationSize(size));
+    TMP_TRACE_RECORD(TraceOp::Allocate, ptr, size);
+
+    return ptr;
+}
+
+void EngineDeallocateFrame(void* ptr, std::size_t size)
+{
+    TMP_TRACE_RECORD(TraceOp::Deallocate, ptr, size);
+
+    if(FrameCache* cache = FrameCache::GetThreadInstance())
+        cache->Deallocate(ptr, size);
+    else
+        PoolManager::GetInstance().Deallocate(ptr);
+}
+
+std::size_t EngineTryExpand(void* ptr, std::size_t newSize)
+{
+    TMP_ASSERT(!LocalHeap::Owns(ptr) && "SingleThreaded heap memory has no block header.");
+
+    PoolManager& manager = PoolManager::GetInstance();
+
+    if(!manager.TryExpand(ptr, newSize))
+        return 0;
+
+    // EngineReallocate   + Ҵ   (   Id ũⰡ newSize ٲ)
+    TMP_TRACE_RECORD(TraceOp::Deallocate, ptr, 0);
+    TMP_TRACE_RECORD(TraceOp::Allocate, ptr, newSize);
+
+    return manager.GetUsableSize(ptr);
+}
+
+void* EngineAllocateLocal(std::size_t size)
+{
+    //   ( Ҹ )   
+    LocalHeap* heap = LocalHeap::GetThreadInstance();
+    void* ptr = heap ? heap->Allocate(size) : LocalHeap::AllocateShared(size);
+    TMP_TRACE_RECORD(TraceOp::Allocate, ptr, size);
+
+    return ptr;
+}
+
+void* EngineAllocateLocalAtLeast(std::size_t size, std::size_t& usableSize)
+{
+    LocalHeap* heap = LocalHeap::GetThreadInstance();
+    void* ptr = heap ? heap->Allocate(size) : LocalHeap::AllocateShared(size);
+    usableSize = (ptr != nullptr) ? LocalHeap::GetUsableSize(size) : 0;
+    TMP_TRACE_RECORD(TraceOp::Allocate, ptr, size);
+
+    return ptr;
+}
+
+void EngineDeallocateLocal(void* ptr, std::size_t size)
+{
+    TMP_TRACE_RECORD(TraceOp::Deallocate, ptr, size);
+
+    if(LocalHeap* heap = LocalHeap::GetThreadInstance())
+        heap->Deallocate(ptr, size);
+    else
+        LocalHeap::DeallocateShared(ptr, size);
+}
+
+void EngineEnterEpoch()
+{
+    EpochManager::GetInstance().Enter();
+}
+
+void EngineExitEpoch()
+{
+    EpochManager::GetInstance().Exit();
+}
+
+void EngineRetire(void* ptr, [[maybe_unused]] std::size_t size)
+{
+    TMP_ASSERT(!LocalHeap::Owns(ptr) && "SingleThreaded heap memory has no block header.");
+
+    //    Retire.  ݳ ̹Ƿ ּ  ġ ʴ´
+    TMP_TRACE_RECORD(TraceOp::Deallocate, ptr, size);
+    EpochManager::GetInstance().Retire(ptr);
+}
+
+std::size_t EngineTryReclaim()
+{
+    return EpochManager::GetInstance().TryReclaim();
+}
+
+std::size_t EngineGetUsableSize(const void* ptr)
+{
+    TMP_ASSERT(!LocalHeap::Owns(ptr) && "SingleThreaded heap memory has no block header.");
+
+    return PoolManager::GetInstance().GetUsableSize(ptr);
+}
+
 } // namespace TinyMemoryPool::Detail
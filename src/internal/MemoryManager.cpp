@@ -2,6 +2,8 @@
 #include "Common.h"
 #include "PlatformMemory.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <new>
 
 namespace TinyMemoryPool
@@ -27,11 +29,16 @@ void MemoryManager::Initialize(const MemoryManagerConfig& config)
         return;
     }
 
-    mTotalReservedSize = config.TotalReserveSize;
-    mReservedBaseAddress = Detail::PlatformMemory::Reserve(mTotalReservedSize);
     mPageSize = Detail::PlatformMemory::GetPageSize();
+    TMP_ASSERT((mPageSize & (mPageSize - 1)) == 0);
+
+    mMaxReservedSize = config.MaxReserveSize;
+    mRegionSize = (std::min(config.TotalReserveSize, mMaxReservedSize) + mPageSize - 1) & ~(mPageSize - 1);
+    mTotalReservedSize = 0;
+
+    // ù  ̸ . ص  ʰ AllocateBlock ٽ õѴ
+    (void) ReserveRegion(mRegionSize);
 
-    mCurrentCommitOffset = 0;
     mIsInitialized = true;
 }
 
@@ -44,44 +51,194 @@ void MemoryManager::Shutdown() noexcept
         return;
     }
 
-    if(mReservedBaseAddress)
+    for(const Region& region : mRegions)
+    {
+        Detail::PlatformMemory::Release(region.BaseAddress, region.Size);
+    }
+    mRegions.clear();
+
+    for(auto& root : mRegionMap)
     {
-        Detail::PlatformMemory::Release(mReservedBaseAddress, mTotalReservedSize);
+        RegionMapNode* node = root.exchange(nullptr, std::memory_order_acq_rel);
+        if(node == nullptr)
+            continue;
+
+        for(auto& leaf : node->Leaves)
+        {
+            delete leaf.load(std::memory_order_relaxed);
+        }
+        delete node;
     }
 
-    mReservedBaseAddress = nullptr;
+    mRegionSize = 0;
+    mMaxReservedSize = 0;
     mTotalReservedSize = 0;
-    mCurrentCommitOffset = 0;
     mPageSize = 0;
     mIsInitialized = false;
 }
 
-[[nodiscard]] void* MemoryManager::AllocateBlock(std::size_t size)
+[[nodiscard]] void* MemoryManager::AllocateBlock(std::size_t size, std::size_t alignment)
 {
     std::lock_guard<std::mutex> lock(mMutex);
 
     TMP_ASSERT(mIsInitialized && "MemoryManager is not initialized.");
 
     const std::size_t pageSize = mPageSize;
-    TMP_ASSERT((pageSize & (pageSize - 1)) == 0);
 
     //  : û ũ⸦   ø (Ʈ ũ )
     const std::size_t alignedSize = (size + pageSize - 1) & ~(pageSize - 1);
 
-    if(mCurrentCommitOffset + alignedSize > mTotalReservedSize)
+    const std::size_t blockAlignment = (alignment > pageSize) ? alignment : pageSize;
+    TMP_ASSERT((blockAlignment & (blockAlignment - 1)) == 0);
+
+    // ֱ    ´ Ȯ (  ƾ  ̸ Grow ÿ ȣ)
+    for(auto it = mRegions.rbegin(); it != mRegions.rend(); ++it)
     {
-        TMP_FATAL_ERROR("Out of reserved memory (MemoryManager). Increase Reserve Size.");
+        if(void* block = CommitFromRegion(*it, alignedSize, blockAlignment))
+            return block;
+    }
+
+    //   .  ū û      
+    const std::size_t alignmentSlack = (blockAlignment > pageSize) ? blockAlignment : 0;
+    const std::size_t regionSize = std::max(mRegionSize, alignedSize + alignmentSlack);
+
+    if(!ReserveRegion(regionSize))
         return nullptr;
+
+    return CommitFromRegion(mRegions.back(), alignedSize, blockAlignment);
+}
+
+[[nodiscard]] bool MemoryManager::Contains(const void* ptr) const noexcept
+{
+    const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+
+    const std::uintptr_t rootIndex = address >> NODE_SHIFT;
+    if(rootIndex >= ROOT_COUNT)
+        return false;
+
+    const RegionMapNode* node = mRegionMap[rootIndex].load(std::memory_order_acquire);
+    if(node == nullptr)
+        return false;
+
+    const std::size_t leafIndex = (address >> LEAF_SHIFT) & (NODE_COUNT - 1);
+    const RegionMapLeaf* leaf = node->Leaves[leafIndex].load(std::memory_order_acquire);
+    if(leaf == nullptr)
+        return false;
+
+    const std::size_t granule = (address >> GRANULE_SHIFT) & ((std::size_t{1} << (LEAF_SHIFT - GRANULE_SHIFT)) - 1);
+
+    return (leaf->Bits[granule / 64].load(std::memory_order_relaxed) >> (granule % 64)) & 1;
+}
+
+[[nodiscard]] std::size_t MemoryManager::GetRegionCount()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mRegions.size();
+}
+
+[[nodiscard]] bool MemoryManager::ReserveRegion(std::size_t size)
+{
+    if(size > mMaxReservedSize - mTotalReservedSize)
+        return false;
+
+    void* baseAddress = Detail::PlatformMemory::ReserveOrNull(size);
+    if(baseAddress == nullptr)
+        return false;
+
+    const Region region = {static_cast<std::byte*>(baseAddress), size, 0};
+
+    if(!MarkRegion(region))
+    {
+        Detail::PlatformMemory::Release(baseAddress, size);
+        return false;
     }
 
-    auto* basePtr = static_cast<std::byte*>(mReservedBaseAddress);
-    void* commitAddress = basePtr + mCurrentCommitOffset;
+    mRegions.push_back(region);
+    mTotalReservedSize += size;
+
+    return true;
+}
+
+[[nodiscard]] void* MemoryManager::CommitFromRegion(Region& region, std::size_t alignedSize,
+                                                    std::size_t blockAlignment)
+{
+    //  ּ :   ּ  ø (ǳʶ  Ŀ )
+    const auto baseAddress = reinterpret_cast<std::uintptr_t>(region.BaseAddress);
+    const std::uintptr_t alignedAddress =
+        (baseAddress + region.CommitOffset + blockAlignment - 1) & ~(static_cast<std::uintptr_t>(blockAlignment) - 1);
+    const std::size_t commitOffset = alignedAddress - baseAddress;
+
+    if(commitOffset > region.Size || alignedSize > region.Size - commitOffset)
+        return nullptr;
+
+    void* commitAddress = region.BaseAddress + commitOffset;
 
     Detail::PlatformMemory::Commit(commitAddress, alignedSize);
 
-    mCurrentCommitOffset += alignedSize;
+    region.CommitOffset = commitOffset + alignedSize;
 
     return commitAddress;
 }
 
+[[nodiscard]] bool MemoryManager::MarkRegion(const Region& region)
+{
+    constexpr std::size_t LEAF_GRANULES = std::size_t{1} << (LEAF_SHIFT - GRANULE_SHIFT);
+
+    const auto begin = reinterpret_cast<std::uintptr_t>(region.BaseAddress);
+    const std::uintptr_t end = begin + region.Size;
+
+    if(((end - 1) >> NODE_SHIFT) >= ROOT_COUNT) [[unlikely]]
+        return false;
+
+    for(std::uintptr_t address = begin; address < end;)
+    {
+        const std::uintptr_t leafIndex = address >> LEAF_SHIFT;
+        const std::uintptr_t leafEnd = std::min(end, (leafIndex + 1) << LEAF_SHIFT);
+
+        //  mMutex Ʒ ϾǷ relaxed а,   release ԽѴ
+        std::atomic<RegionMapNode*>& root = mRegionMap[address >> NODE_SHIFT];
+        RegionMapNode* node = root.load(std::memory_order_relaxed);
+        if(node == nullptr)
+        {
+            node = new(std::nothrow) RegionMapNode{};
+            if(node == nullptr)
+                return false;
+
+            root.store(node, std::memory_order_release);
+        }
+
+        std::atomic<RegionMapLeaf*>& slot = node->Leaves[leafIndex & (NODE_COUNT - 1)];
+        RegionMapLeaf* leaf = slot.load(std::memory_order_relaxed);
+        if(leaf == nullptr)
+        {
+            leaf = new(std::nothrow) RegionMapLeaf{};
+            if(leaf == nullptr)
+                return false;
+
+            slot.store(leaf, std::memory_order_release);
+        }
+
+        // [first, last]  Ʈ   ä
+        const std::size_t first = (address >> GRANULE_SHIFT) & (LEAF_GRANULES - 1);
+        const std::size_t last = ((leafEnd - 1) >> GRANULE_SHIFT) & (LEAF_GRANULES - 1);
+
+        for(std::size_t granule = first; granule <= last;)
+        {
+            const std::size_t word = granule / 64;
+            const std::size_t lowBit = granule % 64;
+            const std::size_t highBit = std::min<std::size_t>(63, last - word * 64);
+
+            const std::uint64_t mask = (~std::uint64_t{0} >> (63 - highBit)) & (~std::uint64_t{0} << lowBit);
+            leaf->Bits[word].fetch_or(mask, std::memory_order_relaxed);
+
+            granule = word * 64 + highBit + 1;
+        }
+
+        address = leafEnd;
+    }
+
+    return true;
+}
+
 } // namespace TinyMemoryPool
@@ -2,14 +2,18 @@
 
 #include <TinyMemoryPool/Config.h>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
+#include <vector>
 
 namespace TinyMemoryPool
 {
 
 /// @brief OSκ  ޸𸮸 (Reserve)ϰ Ŀ(Commit)  йϴ ߾ .
-/// ̱  . α׷    ޸𸮸 ϰ Ѵ.
+///  () Ǹ MaxReserveSize ѵ   ߰ Ѵ.
+/// ̱  . α׷     ϰ Ѵ.
 class MemoryManager final
 {
   public:
@@ -20,7 +24,17 @@ class MemoryManager final
 
     /// @brief  ĵ ޸  ĿϿ ȯѴ.
     /// @param size û ũ (ο   ø ĵ).
-    [[nodiscard]] void* AllocateBlock(std::size_t size);
+    /// @param alignment  ּ  (2 ŵ). 0̸  .
+    /// @return ĿԵ .  (MaxReserveSize) ߰ų OS  źϸ nullptr.
+    /// @note  ߸ ǳʶ   ·θ Ƿ  ޸𸮸 Һ ʴ´.
+    [[nodiscard]] void* AllocateBlock(std::size_t size, std::size_t alignment = 0);
+
+    /// @brief ּҰ   ȿ ִ ˻Ѵ (Lock-Free, O(1)).
+    /// @note Pool/SlabPool ûũ ׻  ȿ Ƿ, System Malloc ϰ ϴ  .
+    [[nodiscard]] bool Contains(const void* ptr) const noexcept;
+
+    /// @brief ݱ   .
+    [[nodiscard]] std::size_t GetRegionCount();
 
   private:
     MemoryManager() = default;
@@ -29,15 +43,55 @@ class MemoryManager final
     MemoryManager(const MemoryManager&) = delete;
     MemoryManager& operator=(const MemoryManager&) = delete;
 
+    static constexpr std::size_t GRANULE_SHIFT = 12; ///<    (4KB).  ׻  .
+    static constexpr std::size_t LEAF_SHIFT = 30;    ///<  ϳ ϴ ּ  (1GB).
+    static constexpr std::size_t NODE_SHIFT = 39;    ///< ߰  ϳ ϴ ּ  (512GB).
+    static constexpr std::size_t ADDRESS_BITS = 48;  ///<    ּ .
+    static constexpr std::size_t ROOT_COUNT = std::size_t{1} << (ADDRESS_BITS - NODE_SHIFT);
+    static constexpr std::size_t NODE_COUNT = std::size_t{1} << (NODE_SHIFT - LEAF_SHIFT);
+
+    struct Region
+    {
+        std::byte* BaseAddress;
+        std::size_t Size;
+        std::size_t CommitOffset;
+    };
+
+    /// @brief   . 1GB ּ  4KB  Ʈ ǥѴ (32KB).
+    struct RegionMapLeaf
+    {
+        std::atomic<std::uint64_t> Bits[(std::size_t{1} << (LEAF_SHIFT - GRANULE_SHIFT)) / 64];
+    };
+
+    /// @brief   ߰ . 512GB ּ   Ų (4KB).
+    struct RegionMapNode
+    {
+        std::atomic<RegionMapLeaf*> Leaves[NODE_COUNT];
+    };
+
+    /// @brief   ϰ  ʿ Ѵ. mMutex  ¿ ȣ.
+    [[nodiscard]] bool ReserveRegion(std::size_t size);
+
+    /// @brief  ȿ  ĿѴ.   ϸ nullptr.
+    [[nodiscard]] void* CommitFromRegion(Region& region, std::size_t alignedSize, std::size_t blockAlignment);
+
+    /// @brief   4KB   ʿ ǥѴ.  Ҵ   false.
+    [[nodiscard]] bool MarkRegion(const Region& region);
+
   private:
     std::mutex mMutex;
     bool mIsInitialized = false;
 
-    void* mReservedBaseAddress = nullptr;
+    std::vector<Region> mRegions;
 
-    std::size_t mCurrentCommitOffset = 0;
+    std::size_t mRegionSize = 0;
+    std::size_t mMaxReservedSize = 0;
     std::size_t mTotalReservedSize = 0;
     std::size_t mPageSize = 0;
+
+    /// @brief ּ ->  Ҽ θ O(1) ã 3ܰ Radix  (Ʈ 4KB).
+    /// ߰     ÿ ȴ.
+    std::atomic<RegionMapNode*> mRegionMap[ROOT_COUNT] = {};
 };
 
 } // namespace TinyMemoryPool
@@ -0,0 +1,217 @@
+#include <TinyMemoryPool/PersistentHeap.h>
+
+#include "PlatformMemory.h"
+#include "RegionHeap.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace TinyMemoryPool
+{
+
+namespace
+{
+
+[[nodiscard]] PersistentHeapError ToError(Detail::RegionHeap::HeaderStatus status) noexcept
+{
+    switch(status)
+    {
+        case Detail::RegionHeap::HeaderStatus::Valid:
+            return PersistentHeapError::None;
+        case Detail::RegionHeap::HeaderStatus::UnsupportedVersion:
+            return PersistentHeapError::UnsupportedVersion;
+        default:
+            return PersistentHeapError::NotAHeap;
+    }
+}
+
+} // namespace
+
+PersistentHeap::PersistentHeap() = default;
+
+PersistentHeap::~PersistentHeap()
+{
+    Close();
+}
+
+bool PersistentHeap::Open(const std::string& path, std::size_t size, void* preferredBase)
+{
+    return Map(path, size, preferredBase, false);
+}
+
+bool PersistentHeap::Create(const std::string& path, std::size_t size, void* preferredBase)
+{
+    return Map(path, size, preferredBase, true);
+}
+
+bool PersistentHeap::Map(const std::string& path, std::size_t size, void* preferredBase, bool format)
+{
+    if(mHeap)
+    {
+        mLastError = PersistentHeapError::AlreadyOpen;
+        return false;
+    }
+
+    mLastError = PersistentHeapError::None;
+
+    //    size øǷ, ٸ 뵵 ̸ ø   о Ȯ
+    if(!format)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        const auto fileSize = file ? static_cast<std::size_t>(file.tellg()) : 0;
+
+        if(fileSize > 0)
+        {
+            Detail::RegionHeader header = {};
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(&header), std::min(fileSize, sizeof(header)));
+
+            mLastError = ToError(Detail::RegionHeap::CheckHeader(&header, fileSize));
+            if(mLastError != PersistentHeapError::None)
+            {
+                return false;
+            }
+        }
+    }
+
+    std::size_t mappedSize = size;
+    bool isNewFile = false;
+
+    void* base = Detail::PlatformMemory::MapFileOrNull(path.c_str(), mappedSize, preferredBase, isNewFile);
+    if(base == nullptr)
+    {
+        mLastError = PersistentHeapError::MapFailed;
+        return false;
+    }
+
+    if(mappedSize < sizeof(Detail::RegionHeader))
+    {
+        Detail::PlatformMemory::UnmapFile(base, mappedSize);
+        mLastError = PersistentHeapError::MapFailed;
+        return false;
+    }
+
+    const bool isFormatted = format || isNewFile;
+
+    // Ȯ  ٸ μ  ٲ  Ƿ      ˻
+    if(!isFormatted)
+    {
+        mLastError = ToError(Detail::RegionHeap::CheckHeader(base, mappedSize));
+        if(mLastError != PersistentHeapError::None)
+        {
+            Detail::PlatformMemory::UnmapFile(base, mappedSize);
+            return false;
+        }
+    }
+
+    void* lastBase = isFormatted ? nullptr : Detail::RegionHeap::GetLastBaseAddress(base, mappedSize);
+    void* wantedBase = (preferredBase != nullptr) ? preferredBase : lastBase;
+
+    // Ʈ  ε ,  ϵ  ּҷ    õ (ص  ̶   )
+    if(wantedBase != nullptr && wantedBase != base)
+    {
+        Detail::PlatformMemory::UnmapFile(base, mappedSize);
+
+        bool unused = false;
+        base = Detail::PlatformMemory::MapFileOrNull(path.c_str(), mappedSize, wantedBase, unused);
+        if(base == nullptr)
+        {
+            mLastError = PersistentHeapError::MapFailed;
+            return false;
+        }
+    }
+
+    mHeap = std::make_unique<Detail::RegionHeap>();
+    mHeap->Attach(base, mappedSize, isFormatted);
+
+    mIsRecovered = !isFormatted;
+    mIsRelocated = mIsRecovered && (lastBase != base);
+
+    mBaseAddress = base;
+    mMappedSize = mappedSize;
+
+    return true;
+}
+
+void PersistentHeap::Close() noexcept
+{
+    if(!mHeap)
+    {
+        return;
+    }
+
+    Flush();
+
+    mHeap->Detach();
+    mHeap.reset();
+
+    Detail::PlatformMemory::UnmapFile(mBaseAddress, mMappedSize);
+
+    mBaseAddress = nullptr;
+    mMappedSize = 0;
+    mIsRecovered = false;
+    mIsRelocated = false;
+}
+
+void PersistentHeap::Flush() noexcept
+{
+    if(mHeap)
+    {
+        Detail::PlatformMemory::FlushFile(mBaseAddress, mMappedSize);
+    }
+}
+
+[[nodiscard]] bool PersistentHeap::IsOpen() const noexcept
+{
+    return mHeap != nullptr;
+}
+
+[[nodiscard]] bool PersistentHeap::IsRecovered() const noexcept
+{
+    return mIsRecovered;
+}
+
+[[nodiscard]] bool PersistentHeap::IsRelocated() const noexcept
+{
+    return mIsRelocated;
+}
+
+[[nodiscard]] PersistentHeapError PersistentHeap::GetLastError() const noexcept
+{
+    return mLastError;
+}
+
+[[nodiscard]] void* PersistentHeap::Allocate(std::size_t size)
+{
+    TMP_ASSERT(mHeap && "PersistentHeap is not open.");
+    return mHeap->Allocate(size);
+}
+
+void PersistentHeap::Deallocate(void* ptr)
+{
+    TMP_ASSERT(mHeap && "PersistentHeap is not open.");
+    mHeap->Deallocate(ptr);
+}
+
+[[nodiscard]] void* PersistentHeap::GetRoot() const noexcept
+{
+    return mHeap ? mHeap->GetRoot() : nullptr;
+}
+
+void PersistentHeap::SetRoot(void* ptr) noexcept
+{
+    TMP_ASSERT(mHeap && "PersistentHeap is not open.");
+    mHeap->SetRoot(ptr);
+}
+
+[[nodiscard]] std::uint64_t PersistentHeap::ToOffset(const void* ptr) const noexcept
+{
+    return mHeap ? mHeap->ToOffset(ptr) : 0;
+}
+
+[[nodiscard]] void* PersistentHeap::FromOffset(std::uint64_t offset) const noexcept
+{
+    return mHeap ? mHeap->FromOffset(offset) : nullptr;
+}
+
+} // namespace TinyMemoryPool
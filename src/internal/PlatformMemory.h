@@ -16,26 +16,54 @@ namespace TinyMemoryPool::Detail
 {
 
 /// @brief ÷  ޸ API ϴ Ļ Ŭ.
-/// Reserve   TMP_FATAL_ERROR  Ѵ.
+/// / д nullptr ˷ ȣڰ óϰ ϰ, Ŀ/ д TMP_FATAL_ERROR Ѵ.
 class PlatformMemory final
 {
   public:
-    [[nodiscard]] static inline void* Reserve(std::size_t size) noexcept
+    /// @brief ּ  Ѵ.   nullptr.
+    [[nodiscard]] static inline void* ReserveOrNull(std::size_t size) noexcept
     {
-        void* ptr = PLATFORM_MEMORY_BACKEND::ReserveOrNull(size);
-        if(ptr == nullptr)
-        {
-            TMP_FATAL_ERROR("PlatformMemory::Reserve failed!");
-        }
-        return ptr;
+        return PLATFORM_MEMORY_BACKEND::ReserveOrNull(size);
     }
 
     static inline void Commit(void* ptr, std::size_t size) noexcept { PLATFORM_MEMORY_BACKEND::Commit(ptr, size); }
 
+    /// @brief ĿԵ   ޸𸮸 OS ȯѴ.
+    /// ּ   · ,   Commit ʿϴ.
+    static inline void Decommit(void* ptr, std::size_t size) noexcept
+    {
+        PLATFORM_MEMORY_BACKEND::Decommit(ptr, size);
+    }
+
     static inline void Release(void* ptr, std::size_t size) noexcept { PLATFORM_MEMORY_BACKEND::Release(ptr, size); }
 
     static inline std::size_t GetPageSize() noexcept { return PLATFORM_MEMORY_BACKEND::GetPageSize(); }
 
+    /// @brief   .    ʰ nullptr ȯϿ ȣڰ óϰ Ѵ.
+    [[nodiscard]] static inline void* MapFileOrNull(const char* path, std::size_t& size, void* preferredBase,
+                                                    bool& isNewFile) noexcept
+    {
+        return PLATFORM_MEMORY_BACKEND::MapFileOrNull(path, size, preferredBase, isNewFile);
+    }
+
+    /// @brief ̸ ִ  ޸ .   nullptr ȯѴ.
+    [[nodiscard]] static inline void* MapSharedOrNull(const char* name, std::size_t& size, bool create) noexcept
+    {
+        return PLATFORM_MEMORY_BACKEND::MapSharedOrNull(name, size, create);
+    }
+
+    static inline bool UnlinkShared(const char* name) noexcept { return PLATFORM_MEMORY_BACKEND::UnlinkShared(name); }
+
+    static inline void FlushFile(void* ptr, std::size_t size) noexcept
+    {
+        PLATFORM_MEMORY_BACKEND::FlushFile(ptr, size);
+    }
+
+    static inline void UnmapFile(void* ptr, std::size_t size) noexcept
+    {
+        PLATFORM_MEMORY_BACKEND::UnmapFile(ptr, size);
+    }
+
   private:
     PlatformMemory() = delete;
     ~PlatformMemory() = delete;
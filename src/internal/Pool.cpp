@@ -25,21 +25,16 @@ void Pool::Shutdown() noexcept
 {
     void* ptr = nullptr;
 
-    if(mFreeList.try_pop(ptr))
+    // Grow  ڿ ٸ 尡  ûũ    Ƿ, Ȯ   õ
+    while(!mFreeList.try_pop(ptr))
     {
-        return ptr;
-    }
-
-    if(Grow())
-    {
-        if(mFreeList.try_pop(ptr))
+        if(!Grow())
         {
-            return ptr;
+            return nullptr;
         }
     }
 
-    TMP_FATAL_ERROR("Failed to pop from pool after growing.");
-    return nullptr;
+    return ptr;
 }
 
 void Pool::Push(void* ptr)
@@ -47,11 +42,6 @@ void Pool::Push(void* ptr)
     mFreeList.push(ptr);
 }
 
-std::size_t Pool::GetChunkSize() const noexcept
-{
-    return mChunkSize;
-}
-
 bool Pool::Grow()
 {
     std::lock_guard<std::mutex> lock(mGrowMutex);
@@ -62,9 +52,24 @@ bool Pool::Grow()
         return true;
     }
 
-    void* newBlock = ::TinyMemoryPool::MemoryManager::GetInstance().AllocateBlock(mNextBlockSize);
+    auto& memoryManager = ::TinyMemoryPool::MemoryManager::GetInstance();
+
+    std::size_t blockSize = mNextBlockSize;
+    void* newBlock = memoryManager.AllocateBlock(blockSize);
+
+    //   ó   ũⰡ      Ƿ ٿ õ
+    while(newBlock == nullptr && blockSize / 2 >= mChunkSize)
+    {
+        blockSize /= 2;
+        newBlock = memoryManager.AllocateBlock(blockSize);
+    }
+
+    if(newBlock == nullptr)
+    {
+        return false;
+    }
 
-    const std::size_t numChunks = mNextBlockSize / mChunkSize;
+    const std::size_t numChunks = blockSize / mChunkSize;
     auto currentChunk = static_cast<std::byte*>(newBlock);
 
     for(std::size_t i = 0; i < numChunks; ++i)
@@ -74,7 +79,7 @@ bool Pool::Grow()
     }
 
     //  Ȯ   ũ⸦ 2 (  )
-    mNextBlockSize *= 2;
+    mNextBlockSize = blockSize * 2;
 
     return true;
 }
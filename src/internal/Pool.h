@@ -1,5 +1,7 @@
 #pragma once
 
+#include "PoolBase.h"
+
 #include <tbb/concurrent_queue.h>
 
 #include <cstddef>
@@ -10,10 +12,12 @@ namespace TinyMemoryPool::Detail
 
 /// @brief  ũ ޸ ûũ ϴ Lock-Free (κ) Ǯ.
 /// Intel TBB concurrent_queue Ͽ κ Ҵ/   Ѵ.
-class Pool final
+class Pool final : public PoolBase
 {
   public:
-    Pool() = default;
+    Pool() noexcept : PoolBase(PoolBackend::FreeList)
+    {
+    }
     ~Pool() = default;
 
     Pool(const Pool&) = delete;
@@ -29,21 +33,19 @@ class Pool final
     void Shutdown() noexcept;
 
     /// @brief  ûũ ϳ  (Thread-Safe).
-    /// @return ȿ ޸ ּ.   TMP_FATAL_ERROR .
+    /// @return ȿ ޸ ּ. Ȯ忡 ϸ(  ) nullptr.
     [[nodiscard]] void* Pop();
 
     /// @brief  Ϸ ûũ ݳѴ (Thread-Safe).
     void Push(void* ptr);
 
-    std::size_t GetChunkSize() const noexcept;
-
   private:
     /// @brief  ûũ   MemoryManagerκ   ޾ ȮѴ.
     /// @note Double-Checked Locking ߺ Ȯ Ѵ.
+    /// @return MemoryManager   ϸ false.
     bool Grow();
 
   private:
-    std::size_t mChunkSize = 0;
     std::size_t mNextBlockSize = 0;
 
     tbb::concurrent_queue<void*> mFreeList;
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TinyMemoryPool::Detail
+{
+
+/// @brief ũ Ŭ   Ǯ .
+enum class PoolBackend : std::uint8_t
+{
+    FreeList, ///< Pool: TBB concurrent_queue   Free List.
+    Bitmap,   ///< SlabPool: Span   Ʈ.
+};
+
+/// @brief Pool/SlabPool  κ. BlockHeader::OwnerPool Ű Ÿ̴.
+/// @note Ҹ ܿ  Լ  ʰ Backend  бϿ Hot Path  ȣ Ѵ.
+class PoolBase
+{
+  public:
+    virtual ~PoolBase() = default;
+
+    [[nodiscard]] PoolBackend GetBackend() const noexcept
+    {
+        return mBackend;
+    }
+
+    [[nodiscard]] std::size_t GetChunkSize() const noexcept
+    {
+        return mChunkSize;
+    }
+
+  protected:
+    explicit PoolBase(PoolBackend backend) noexcept : mBackend(backend)
+    {
+    }
+
+    PoolBase(const PoolBase&) = delete;
+    PoolBase& operator=(const PoolBase&) = delete;
+
+  protected:
+    std::size_t mChunkSize = 0;
+
+  private:
+    PoolBackend mBackend;
+};
+
+} // namespace TinyMemoryPool::Detail
@@ -2,11 +2,19 @@
 #include "Common.h"
 #include "MemoryManager.h"
 #include "Pool.h"
+#include "SlabPool.h"
 
 #include <algorithm>
 #include <bit>
 #include <cstdlib>
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <mutex>
+
+#if defined(_WIN32) || defined(__GLIBC__)
+#include <malloc.h>
+#endif
 
 namespace
 {
@@ -23,6 +31,54 @@ using namespace TinyMemoryPool::Detail;
     return static_cast<BlockHeader*>(payload) - 1;
 }
 
+[[nodiscard]] inline const BlockHeader* GetHeaderAddress(const void* payload)
+{
+    return static_cast<const BlockHeader*>(payload) - 1;
+}
+
+/// @brief System Malloc   Ȯ ũ.    ÷ û ũ⸦ ״ .
+[[nodiscard]] inline std::size_t GetSystemBlockCapacity(const BlockHeader* header)
+{
+#if defined(_WIN32)
+    return _msize(const_cast<BlockHeader*>(header));
+#elif defined(__GLIBC__)
+    return malloc_usable_size(const_cast<BlockHeader*>(header));
+#else
+    return header->Size;
+#endif
+}
+
+/// @brief 鿣忡  ûũ .  ȣ  б   óѴ.
+[[nodiscard]] inline void* PopChunk(PoolBase* pool)
+{
+    if(pool->GetBackend() == PoolBackend::Bitmap)
+        return static_cast<SlabPool*>(pool)->Pop();
+
+    return static_cast<Pool*>(pool)->Pop();
+}
+
+inline void PushChunk(PoolBase* pool, void* chunk)
+{
+    if(pool->GetBackend() == PoolBackend::Bitmap)
+        static_cast<SlabPool*>(pool)->Push(chunk);
+    else
+        static_cast<Pool*>(pool)->Push(chunk);
+}
+
+/// @brief Configure     . PoolManager     д´.
+struct PendingConfig
+{
+    std::mutex Mutex;
+    TinyMemoryPool::MemoryManagerConfig Config;
+    bool IsConsumed = false;
+};
+
+[[nodiscard]] PendingConfig& GetPendingConfig()
+{
+    static PendingConfig pending;
+    return pending;
+}
+
 } // namespace
 
 namespace TinyMemoryPool::Detail
@@ -34,9 +90,28 @@ PoolManager& PoolManager::GetInstance()
     return instance;
 }
 
+bool PoolManager::Configure(const MemoryManagerConfig& config)
+{
+    PendingConfig& pending = GetPendingConfig();
+    std::lock_guard<std::mutex> lock(pending.Mutex);
+
+    if(pending.IsConsumed)
+        return false;
+
+    pending.Config = config;
+    return true;
+}
+
 PoolManager::PoolManager()
 {
     MemoryManagerConfig config;
+    {
+        PendingConfig& pending = GetPendingConfig();
+        std::lock_guard<std::mutex> lock(pending.Mutex);
+
+        pending.IsConsumed = true;
+        config = pending.Config;
+    }
     MemoryManager::GetInstance().Initialize(config);
 
     Initialize();
@@ -58,13 +133,21 @@ void PoolManager::Initialize()
 
     for(std::size_t i = 0; i < POOL_COUNT; ++i)
     {
-        auto newPool = std::make_unique<Pool>();
-
         //  ûũϼ ʱ Ȯ ÷ Hot Path Grow ȣ 
         std::size_t initialItemCount = (currentChunkSize <= 256) ? 4096 : (currentChunkSize <= 1024) ? 1024 : 256;
 
-        newPool->Initialize(currentChunkSize, currentChunkSize * initialItemCount);
-        mPools.push_back(std::move(newPool));
+        if((TMP_BITMAP_POOL_MASK >> i) & 1)
+        {
+            auto newPool = std::make_unique<SlabPool>();
+            newPool->Initialize(currentChunkSize, currentChunkSize * initialItemCount);
+            mPools.push_back(std::move(newPool));
+        }
+        else
+        {
+            auto newPool = std::make_unique<Pool>();
+            newPool->Initialize(currentChunkSize, currentChunkSize * initialItemCount);
+            mPools.push_back(std::move(newPool));
+        }
 
         currentChunkSize *= 2;
     }
@@ -79,9 +162,13 @@ void PoolManager::Shutdown()
 
     for(auto& pool : mPools)
     {
-        if(pool)
+        if(pool && pool->GetBackend() == PoolBackend::Bitmap)
+        {
+            static_cast<SlabPool*>(pool.get())->Shutdown();
+        }
+        else if(pool)
         {
-            pool->Shutdown();
+            static_cast<Pool*>(pool.get())->Shutdown();
         }
     }
     mPools.clear();
@@ -99,7 +186,7 @@ void PoolManager::Shutdown()
         const std::size_t index = GetPoolIndex(totalSize);
         TMP_ASSERT(index < mPools.size());
 
-        void* block = mPools[index]->Pop();
+        void* block = PopChunk(mPools[index].get());
         if(!block) [[unlikely]]
             return nullptr;
 
@@ -122,6 +209,35 @@ void PoolManager::Shutdown()
     return GetPayloadAddress(header);
 }
 
+[[nodiscard]] void* PoolManager::AllocateNear(std::size_t size, const void* hint)
+{
+    const std::size_t totalSize = size + sizeof(BlockHeader);
+
+    // System Malloc  ġ   ,    hint  ʴ´
+    if(hint == nullptr || totalSize > MAX_BLOCK_SIZE || !MemoryManager::GetInstance().Contains(hint))
+        return Allocate(size);
+
+    const std::size_t index = GetPoolIndex(totalSize);
+    TMP_ASSERT(index < mPools.size());
+
+    PoolBase* pool = mPools[index].get();
+
+    // Free List Pool ûũ    Ƿ  Ŭ  hint 
+    if(pool->GetBackend() != PoolBackend::Bitmap)
+        return Allocate(size);
+
+    // hint   ʴ´.    ȯ ּ  Ƿ   ڱ Span  
+    void* block = static_cast<SlabPool*>(pool)->PopNear(GetHeaderAddress(hint));
+    if(!block)
+        return Allocate(size);
+
+    BlockHeader* header = static_cast<BlockHeader*>(block);
+    header->OwnerPool = pool;
+    header->Size = totalSize;
+
+    return GetPayloadAddress(header);
+}
+
 void PoolManager::Deallocate(void* ptr)
 {
     if(ptr == nullptr)
@@ -131,7 +247,7 @@ void PoolManager::Deallocate(void* ptr)
 
     if(header->OwnerPool)
     {
-        header->OwnerPool->Push(header);
+        PushChunk(header->OwnerPool, header);
     }
     else
     {
@@ -139,6 +255,119 @@ void PoolManager::Deallocate(void* ptr)
     }
 }
 
+void PoolManager::DeallocateBatch(void** ptrs, std::size_t count)
+{
+    // Free List Pool System Malloc     Ƿ ٷ ݳϰ,
+    //  ûũ( ּ) 迭  
+    std::size_t slabCount = 0;
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        BlockHeader* header = GetHeaderAddress(ptrs[i]);
+        PoolBase* pool = header->OwnerPool;
+
+        if(pool == nullptr)
+            std::free(header);
+        else if(pool->GetBackend() == PoolBackend::Bitmap)
+            ptrs[slabCount++] = header;
+        else
+            static_cast<Pool*>(pool)->Push(header);
+    }
+
+    if(slabCount == 0)
+        return;
+
+    //  Ǯ -> ּ  Ͽ  Ǯ( Span) ûũ ӵǵ 
+    std::sort(ptrs, ptrs + slabCount, [](const void* a, const void* b) {
+        const PoolBase* ownerA = static_cast<const BlockHeader*>(a)->OwnerPool;
+        const PoolBase* ownerB = static_cast<const BlockHeader*>(b)->OwnerPool;
+        return (ownerA != ownerB) ? std::less<const PoolBase*>()(ownerA, ownerB) : std::less<const void*>()(a, b);
+    });
+
+    std::size_t begin = 0;
+    while(begin < slabCount)
+    {
+        PoolBase* pool = static_cast<BlockHeader*>(ptrs[begin])->OwnerPool;
+
+        std::size_t end = begin + 1;
+        while(end < slabCount && static_cast<BlockHeader*>(ptrs[end])->OwnerPool == pool)
+        {
+            ++end;
+        }
+
+        // Ǯ     ӵ ûũ ݳ
+        static_cast<SlabPool*>(pool)->PushBatch(ptrs + begin, end - begin);
+
+        begin = end;
+    }
+}
+
+[[nodiscard]] void* PoolManager::Reallocate(void* ptr, std::size_t newSize)
+{
+    if(ptr == nullptr)
+        return Allocate(newSize);
+
+    if(newSize == 0)
+    {
+        Deallocate(ptr);
+        return nullptr;
+    }
+
+    if(TryExpand(ptr, newSize))
+        return ptr;
+
+    BlockHeader* header = GetHeaderAddress(ptr);
+    const std::size_t newTotalSize = newSize + sizeof(BlockHeader);
+
+    // System Malloc ϳ realloc  (glibc ū Ͽ  mremap  ű ʰ Ȯ)
+    if(header->OwnerPool == nullptr && newTotalSize > MAX_BLOCK_SIZE)
+    {
+        void* block = std::realloc(header, newTotalSize);
+        if(!block) [[unlikely]]
+            return nullptr;
+
+        header = static_cast<BlockHeader*>(block);
+        header->Size = newTotalSize;
+
+        return GetPayloadAddress(header);
+    }
+
+    void* newPtr = Allocate(newSize);
+    if(!newPtr) [[unlikely]]
+        return nullptr;
+
+    const std::size_t oldSize = header->Size - sizeof(BlockHeader);
+    std::memcpy(newPtr, ptr, std::min(oldSize, newSize));
+
+    Deallocate(ptr);
+
+    return newPtr;
+}
+
+[[nodiscard]] bool PoolManager::TryExpand(void* ptr, std::size_t newSize)
+{
+    if(ptr == nullptr)
+        return false;
+
+    if(newSize > GetUsableSize(ptr))
+        return false;
+
+    GetHeaderAddress(ptr)->Size = newSize + sizeof(BlockHeader);
+
+    return true;
+}
+
+[[nodiscard]] std::size_t PoolManager::GetUsableSize(const void* ptr) const
+{
+    if(ptr == nullptr)
+        return 0;
+
+    const BlockHeader* header = GetHeaderAddress(ptr);
+
+    const std::size_t capacity = header->OwnerPool ? header->OwnerPool->GetChunkSize() : GetSystemBlockCapacity(header);
+
+    return capacity - sizeof(BlockHeader);
+}
+
 [[nodiscard]] std::size_t PoolManager::GetPoolIndex(std::size_t totalSize) const
 {
     // 64B ̸ û ּ 64B Ǯ(index 0) 
@@ -8,16 +8,22 @@
 #include <memory>
 #include <vector>
 
+/// @brief Ʈ (SlabPool)  ũ Ŭ ũ. Ʈ i = (64B << i) Ŭ.
+/// @note ⺻ 0  Ŭ Free List Pool Ѵ. CMake TMP_BITMAP_POOL_MASK .
+#if !defined(TMP_BITMAP_POOL_MASK)
+#define TMP_BITMAP_POOL_MASK 0
+#endif
+
 namespace TinyMemoryPool::Detail
 {
 
-class Pool;
+class PoolBase;
 
 /// @brief ޸  մ Ÿ (16 Bytes).
 /// @note 16Ʈ    е  .
 struct BlockHeader
 {
-    Pool* OwnerPool;    ///<  Pool. nullptr̸ System Malloc Ҵ.
+    PoolBase* OwnerPool; ///<  Pool/SlabPool. nullptr̸ System Malloc Ҵ.
     std::size_t Size;   ///< ü Ҵ ũ (Header ).
 };
 
@@ -28,6 +34,10 @@ class PoolManager final
   public:
     static PoolManager& GetInstance();
 
+    /// @brief ù Ҵ  MemoryManager ( ũ,  ) Ѵ.
+    /// @return ̹ PoolManager Ǿ     false.
+    [[nodiscard]] static bool Configure(const MemoryManagerConfig& config);
+
     void Initialize();
     void Shutdown();
 
@@ -35,10 +45,33 @@ class PoolManager final
     /// @param size  û ũ (Byte).
     [[nodiscard]] void* Allocate(std::size_t size);
 
+    /// @brief hint  Span(  켱) ġǵ õϴ Ҵ.
+    /// @param hint Allocate/AllocateNear Ҵ޾    ּ, Ǵ nullptr.  ּ ޸𸮴  ʴ´.
+    /// @note Ʈ  Ŭ̸鼭 hint  ũ Ŭ  ȿ ְ,  ܿ Allocate ϴ.
+    [[nodiscard]] void* AllocateNear(std::size_t size, const void* hint);
+
     /// @brief   ޸ .
     /// @param ptr Allocate Ҵ ޸ ּ.
     void Deallocate(void* ptr);
 
+    /// @brief  Ҵ Ѳ Ѵ.  Ŭ ûũ Ǯ      ݳϸ,
+    /// Free List Pool System Malloc  ϳ ٷ ݳѴ (⺻ 忡 Deallocate ݺ ).
+    /// @param ptrs Allocate Ҵ ּ 迭.  .
+    void DeallocateBatch(void** ptrs, std::size_t count);
+
+    /// @brief Ҵ ũ⸦ Ѵ. ڸ Ȯ Ұϸ  Ҵ  Ѵ.
+    /// @param ptr Allocate Ҵ ޸ ּ. nullptr̸ Allocate .
+    /// @param newSize  û ũ (Byte). 0̸ Deallocate  nullptr ȯ.
+    /// @return  ּ.   nullptr̸ ptr ״ ȿϴ.
+    [[nodiscard]] void* Reallocate(void* ptr, std::size_t newSize);
+
+    /// @brief ּ ̵  Ҵ ũ⸦ newSize  õѴ.
+    /// Pool ûũ ũ Ŭ   , System Malloc  malloc   ũ  Ѵ.
+    [[nodiscard]] bool TryExpand(void* ptr, std::size_t newSize);
+
+    /// @brief Ҵ ּ ̵    ִ  ũ (Header ).
+    [[nodiscard]] std::size_t GetUsableSize(const void* ptr) const;
+
   private:
     PoolManager();
     ~PoolManager();
@@ -49,7 +82,7 @@ class PoolManager final
     [[nodiscard]] std::size_t GetPoolIndex(std::size_t totalSize) const;
 
   private:
-    std::vector<std::unique_ptr<Pool>> mPools;
+    std::vector<std::unique_ptr<PoolBase>> mPools;
     bool mIsInitialized = false;
 
     static constexpr std::size_t MIN_BIT_SHIFT = 6;      ///< ּ ûũ 64B = 2^6.
@@ -0,0 +1,247 @@
+#include "RegionHeap.h"
+#include "Common.h"
+
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <limits>
+
+namespace TinyMemoryPool::Detail
+{
+
+namespace
+{
+
+constexpr std::size_t MIN_BIT_SHIFT = 6;  ///< ּ  64B = 2^6.
+constexpr std::size_t DATA_ALIGNMENT = 64; ///< ù  .   Ŭ ũ  ̾.
+
+/// Free List Ӹ = [ 24bit: ABA ±][ 40bit:  / 64]. ִ 64TB  ǥ .
+constexpr std::uint64_t TAG_SHIFT = 40;
+constexpr std::uint64_t INDEX_MASK = (std::uint64_t{1} << TAG_SHIFT) - 1;
+
+static_assert(std::atomic_ref<std::uint64_t>::is_always_lock_free,
+              "Process-shared free lists require lock-free 64-bit atomics.");
+
+[[nodiscard]] inline std::atomic_ref<std::uint64_t> AtomicField(std::uint64_t& field)
+{
+    return std::atomic_ref<std::uint64_t>(field);
+}
+
+[[nodiscard]] inline std::uint64_t PackHead(std::uint64_t offset, std::uint64_t tag)
+{
+    return (tag << TAG_SHIFT) | (offset >> MIN_BIT_SHIFT);
+}
+
+[[nodiscard]] inline std::uint64_t GetHeadOffset(std::uint64_t head)
+{
+    return (head & INDEX_MASK) << MIN_BIT_SHIFT;
+}
+
+[[nodiscard]] inline std::uint64_t GetNextTag(std::uint64_t head)
+{
+    return (head >> TAG_SHIFT) + 1;
+}
+
+[[nodiscard]] inline RegionBlockHeader* GetBlockHeader(void* payload)
+{
+    return static_cast<RegionBlockHeader*>(payload) - 1;
+}
+
+} // namespace
+
+void RegionHeap::Attach(void* base, std::size_t size, bool format)
+{
+    mBase = static_cast<std::byte*>(base);
+    mHeader = static_cast<RegionHeader*>(base);
+
+    if(format)
+    {
+        Format(size);
+    }
+    else
+    {
+        //  ͸  ʵ  δ ȣ  CheckHeader  Ѵ
+        TMP_ASSERT(CheckHeader(base, size) == HeaderStatus::Valid && "RegionHeap::Attach on an invalid header.");
+    }
+
+    //  Ŀ þ  Ѵ (CommitOffset Ĵ  й  )
+    auto regionSize = AtomicField(mHeader->RegionSize);
+    std::uint64_t currentSize = regionSize.load(std::memory_order_relaxed);
+    while(size > currentSize && !regionSize.compare_exchange_weak(currentSize, size, std::memory_order_release))
+    {
+    }
+    AtomicField(mHeader->LastBaseAddress).store(reinterpret_cast<std::uint64_t>(base), std::memory_order_relaxed);
+}
+
+void RegionHeap::Detach() noexcept
+{
+    mBase = nullptr;
+    mHeader = nullptr;
+}
+
+[[nodiscard]] void* RegionHeap::Allocate(std::size_t size)
+{
+    TMP_ASSERT(mHeader && "RegionHeap is not attached.");
+
+    //  ũ⸦ ϸ ÷ϴ û  ū Ŭε   
+    if(size > std::numeric_limits<std::size_t>::max() - sizeof(RegionBlockHeader)) [[unlikely]]
+        return nullptr;
+
+    const std::size_t classIndex = GetClassIndex(size + sizeof(RegionBlockHeader));
+    if(classIndex >= RegionHeader::CLASS_COUNT) [[unlikely]]
+        return nullptr;
+
+    std::uint64_t offset = PopFreeBlock(classIndex);
+
+    if(offset == 0)
+    {
+        offset = CommitBlock(std::uint64_t{1} << (classIndex + MIN_BIT_SHIFT));
+        if(offset == 0) [[unlikely]]
+            return nullptr;
+    }
+
+    auto* block = reinterpret_cast<RegionBlockHeader*>(mBase + offset);
+    block->ClassIndex = classIndex;
+
+    return block + 1;
+}
+
+void RegionHeap::Deallocate(void* ptr)
+{
+    if(ptr == nullptr)
+        return;
+
+    TMP_ASSERT(mHeader && "RegionHeap is not attached.");
+
+    RegionBlockHeader* block = GetBlockHeader(ptr);
+    const std::uint64_t offset = ToOffset(block);
+
+    TMP_ASSERT(offset >= mHeader->HeaderSize && offset < AtomicField(mHeader->CommitOffset).load());
+    TMP_ASSERT(block->ClassIndex < RegionHeader::CLASS_COUNT);
+
+    PushFreeBlock(block->ClassIndex, offset);
+}
+
+[[nodiscard]] void* RegionHeap::GetRoot() const noexcept
+{
+    return FromOffset(AtomicField(mHeader->RootOffset).load(std::memory_order_acquire));
+}
+
+void RegionHeap::SetRoot(void* ptr) noexcept
+{
+    AtomicField(mHeader->RootOffset).store(ToOffset(ptr), std::memory_order_release);
+}
+
+[[nodiscard]] std::uint64_t RegionHeap::ToOffset(const void* ptr) const noexcept
+{
+    if(ptr == nullptr)
+        return 0;
+
+    return static_cast<std::uint64_t>(static_cast<const std::byte*>(ptr) - mBase);
+}
+
+[[nodiscard]] void* RegionHeap::FromOffset(std::uint64_t offset) const noexcept
+{
+    return (offset == 0) ? nullptr : mBase + offset;
+}
+
+[[nodiscard]] void* RegionHeap::GetLastBaseAddress(const void* base, std::size_t size) noexcept
+{
+    if(CheckHeader(base, size) != HeaderStatus::Valid)
+        return nullptr;
+
+    return reinterpret_cast<void*>(static_cast<const RegionHeader*>(base)->LastBaseAddress);
+}
+
+[[nodiscard]] RegionHeap::HeaderStatus RegionHeap::CheckHeader(const void* base, std::size_t size) noexcept
+{
+    if(size < sizeof(RegionHeader))
+        return HeaderStatus::NotARegion;
+
+    const auto* header = static_cast<const RegionHeader*>(base);
+    if(header->Magic != RegionHeader::MAGIC)
+        return HeaderStatus::NotARegion;
+
+    if(header->Version != RegionHeader::VERSION)
+        return HeaderStatus::UnsupportedVersion;
+
+    if(header->HeaderSize < sizeof(RegionHeader) || header->HeaderSize > header->CommitOffset ||
+       header->CommitOffset > size)
+        return HeaderStatus::NotARegion;
+
+    return HeaderStatus::Valid;
+}
+
+[[nodiscard]] std::size_t RegionHeap::GetClassIndex(std::size_t totalSize) noexcept
+{
+    // 64B ̸ û ּ 64B Ŭ(index 0) 
+    const std::size_t clampedSize = (totalSize < (1 << MIN_BIT_SHIFT)) ? (1 << MIN_BIT_SHIFT) : totalSize;
+
+    return std::bit_width(clampedSize - 1) - MIN_BIT_SHIFT;
+}
+
+[[nodiscard]] std::uint64_t RegionHeap::PopFreeBlock(std::size_t classIndex) noexcept
+{
+    auto head = AtomicField(mHeader->FreeListHeads[classIndex]);
+    std::uint64_t current = head.load(std::memory_order_acquire);
+
+    while(GetHeadOffset(current) != 0)
+    {
+        const std::uint64_t offset = GetHeadOffset(current);
+        auto* block = reinterpret_cast<RegionBlockHeader*>(mBase + offset);
+
+        // ٸ /μ   ٸ Next   , ±װ ޶ CAS Ѵ
+        const std::uint64_t next = AtomicField(block->NextOffset).load(std::memory_order_relaxed);
+
+        if(head.compare_exchange_weak(current, PackHead(next, GetNextTag(current)), std::memory_order_acquire,
+                                      std::memory_order_acquire))
+        {
+            return offset;
+        }
+    }
+
+    return 0;
+}
+
+void RegionHeap::PushFreeBlock(std::size_t classIndex, std::uint64_t offset) noexcept
+{
+    auto head = AtomicField(mHeader->FreeListHeads[classIndex]);
+    auto* block = reinterpret_cast<RegionBlockHeader*>(mBase + offset);
+
+    std::uint64_t current = head.load(std::memory_order_relaxed);
+    do
+    {
+        AtomicField(block->NextOffset).store(GetHeadOffset(current), std::memory_order_relaxed);
+    } while(!head.compare_exchange_weak(current, PackHead(offset, GetNextTag(current)), std::memory_order_release,
+                                        std::memory_order_relaxed));
+}
+
+[[nodiscard]] std::uint64_t RegionHeap::CommitBlock(std::uint64_t classSize) noexcept
+{
+    auto commitOffset = AtomicField(mHeader->CommitOffset);
+    const std::uint64_t regionSize = AtomicField(mHeader->RegionSize).load(std::memory_order_acquire);
+
+    std::uint64_t current = commitOffset.load(std::memory_order_relaxed);
+    do
+    {
+        if(current + classSize > regionSize)
+            return 0;
+    } while(!commitOffset.compare_exchange_weak(current, current + classSize, std::memory_order_relaxed));
+
+    return current;
+}
+
+void RegionHeap::Format(std::size_t size) noexcept
+{
+    std::memset(mHeader, 0, sizeof(RegionHeader));
+
+    const std::size_t headerSize = (sizeof(RegionHeader) + DATA_ALIGNMENT - 1) & ~(DATA_ALIGNMENT - 1);
+
+    mHeader->Magic = RegionHeader::MAGIC;
+    mHeader->Version = RegionHeader::VERSION;
+    mHeader->HeaderSize = static_cast<std::uint32_t>(headerSize);
+    mHeader->RegionSize = size;
+    mHeader->CommitOffset = headerSize;
+}
+
+} // namespace TinyMemoryPool::Detail
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TinyMemoryPool::Detail
+{
+
+/// @brief ε   տ Ǵ  .
+/// @note   Base   ϹǷ ٸ ּҿ ٽ εǾ ״ ȿϴ.
+///  μ     ֵ  ʵ std::atomic_refθ Ѵ.
+struct RegionHeader
+{
+    static constexpr std::uint64_t MAGIC = 0x4C4F4F504D505400; ///< "\0TPMPOOL"
+    static constexpr std::uint32_t VERSION = 2;
+    static constexpr std::size_t CLASS_COUNT = 40;              ///< 64B ~ 2^45B ũ Ŭ.
+
+    std::uint64_t Magic;
+    std::uint32_t Version;
+    std::uint32_t HeaderSize;
+    std::uint64_t RegionSize;
+    std::uint64_t LastBaseAddress;                 ///<  εǾ ּ ( Ʈ).
+    std::uint64_t CommitOffset;                    ///<    й    .
+    std::uint64_t RootOffset;                      ///<  Ʈ ü. 0̸ .
+    std::uint64_t FreeListHeads[CLASS_COUNT];      ///< ũ Ŭ Free List Ӹ (ABA ± ). 0̸  .
+};
+
+/// @brief Region   Ÿ (16 Bytes).
+struct RegionBlockHeader
+{
+    std::uint64_t ClassIndex;   ///< ũ Ŭ (2^(6 + ClassIndex) Bytes, Header ).
+    std::uint64_t NextOffset;   ///<    Free List   .
+};
+
+/// @brief ܺο   ޸ (,  ޸ )  ϴ   Lock-Free .
+///  ü / (PersistentHeap, SharedHeap) ϰ, ⼭ й踸 Ѵ.
+/// @note  ¸ μ ÿ  Ƿ  μ ÿ Ҵ/ص ϴ.
+class RegionHeap final
+{
+  public:
+    RegionHeap() = default;
+    ~RegionHeap() = default;
+
+    RegionHeap(const RegionHeap&) = delete;
+    RegionHeap& operator=(const RegionHeap&) = delete;
+
+    /// @brief  պκ  ˻ .
+    enum class HeaderStatus : std::uint8_t
+    {
+        Valid,              ///<    .
+        UnsupportedVersion, ///<    尡    .
+        NotARegion,         ///<   ƴ (ٸ 뵵 ).
+    };
+
+    /// @brief  Ѵ.
+    /// @param base ε   ּ.
+    /// @param size  ũ (Byte).
+    /// @param format true   ϰ Ѵ. false  Valid Ѵ (CheckHeader  Ȯ).
+    void Attach(void* base, std::size_t size, bool format);
+
+    void Detach() noexcept;
+
+    /// @brief   ҴѴ (Lock-Free, Process-Shared).
+    /// @return ȿ ּ.   á nullptr.
+    [[nodiscard]] void* Allocate(std::size_t size);
+
+    /// @brief  ũ Ŭ Free List ȯѴ (Lock-Free, Process-Shared).
+    void Deallocate(void* ptr);
+
+    [[nodiscard]] void* GetRoot() const noexcept;
+    void SetRoot(void* ptr) noexcept;
+
+    [[nodiscard]] std::uint64_t ToOffset(const void* ptr) const noexcept;
+    [[nodiscard]] void* FromOffset(std::uint64_t offset) const noexcept;
+
+    /// @brief    εǾ ּ. ȿ   nullptr.
+    [[nodiscard]] static void* GetLastBaseAddress(const void* base, std::size_t size) noexcept;
+
+    /// @param base  (Ǵ  պκ о  )  ּ.
+    /// @param size  ü ũ (Byte).     ȿ ִ Բ ˻Ѵ.
+    [[nodiscard]] static HeaderStatus CheckHeader(const void* base, std::size_t size) noexcept;
+
+  private:
+    [[nodiscard]] static std::size_t GetClassIndex(std::size_t totalSize) noexcept;
+
+    /// @brief Free List  ϳ .   0.
+    [[nodiscard]] std::uint64_t PopFreeBlock(std::size_t classIndex) noexcept;
+    void PushFreeBlock(std::size_t classIndex, std::uint64_t offset) noexcept;
+
+    /// @brief  й   classSizeŭ ߶󳽴.   0.
+    [[nodiscard]] std::uint64_t CommitBlock(std::uint64_t classSize) noexcept;
+
+    void Format(std::size_t size) noexcept;
+
+  private:
+    std::byte* mBase = nullptr;
+    RegionHeader* mHeader = nullptr;
+};
+
+} // namespace TinyMemoryPool::Detail
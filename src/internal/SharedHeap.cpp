@@ -0,0 +1,121 @@
+#include <TinyMemoryPool/SharedHeap.h>
+
+#include "PlatformMemory.h"
+#include "RegionHeap.h"
+
+namespace TinyMemoryPool
+{
+
+SharedHeap::SharedHeap() = default;
+
+SharedHeap::~SharedHeap()
+{
+    Close();
+}
+
+bool SharedHeap::Create(const std::string& name, std::size_t size)
+{
+    if(mHeap || size < sizeof(Detail::RegionHeader))
+    {
+        return false;
+    }
+
+    std::size_t mappedSize = size;
+    void* base = Detail::PlatformMemory::MapSharedOrNull(name.c_str(), mappedSize, true);
+    if(base == nullptr)
+    {
+        return false;
+    }
+
+    return Attach(base, mappedSize, true);
+}
+
+bool SharedHeap::Open(const std::string& name)
+{
+    if(mHeap)
+    {
+        return false;
+    }
+
+    std::size_t mappedSize = 0;
+    void* base = Detail::PlatformMemory::MapSharedOrNull(name.c_str(), mappedSize, false);
+    if(base == nullptr)
+    {
+        return false;
+    }
+
+    //     ʾҰų ٸ 뵵 ü ǵ帮 ʰ 
+    if(Detail::RegionHeap::CheckHeader(base, mappedSize) != Detail::RegionHeap::HeaderStatus::Valid)
+    {
+        Detail::PlatformMemory::UnmapFile(base, mappedSize);
+        return false;
+    }
+
+    return Attach(base, mappedSize, false);
+}
+
+void SharedHeap::Close() noexcept
+{
+    if(!mHeap)
+    {
+        return;
+    }
+
+    mHeap->Detach();
+    mHeap.reset();
+
+    Detail::PlatformMemory::UnmapFile(mBaseAddress, mMappedSize);
+
+    mBaseAddress = nullptr;
+    mMappedSize = 0;
+}
+
+bool SharedHeap::Unlink(const std::string& name) noexcept
+{
+    return Detail::PlatformMemory::UnlinkShared(name.c_str());
+}
+
+[[nodiscard]] bool SharedHeap::IsOpen() const noexcept
+{
+    return mHeap != nullptr;
+}
+
+[[nodiscard]] void* SharedHeap::Allocate(std::size_t size)
+{
+    TMP_ASSERT(mHeap && "SharedHeap is not open.");
+    return mHeap->Allocate(size);
+}
+
+void SharedHeap::Deallocate(void* ptr)
+{
+    TMP_ASSERT(mHeap && "SharedHeap is not open.");
+    mHeap->Deallocate(ptr);
+}
+
+void SharedHeap::Deallocate(SharedHandle handle)
+{
+    Deallocate(FromHandle(handle));
+}
+
+[[nodiscard]] SharedHandle SharedHeap::ToHandle(const void* ptr) const noexcept
+{
+    return SharedHandle{mHeap ? mHeap->ToOffset(ptr) : 0};
+}
+
+[[nodiscard]] void* SharedHeap::FromHandle(SharedHandle handle) const noexcept
+{
+    return mHeap ? mHeap->FromOffset(handle.Offset) : nullptr;
+}
+
+bool SharedHeap::Attach(void* base, std::size_t size, bool format)
+{
+    mHeap = std::make_unique<Detail::RegionHeap>();
+    mHeap->Attach(base, size, format);
+
+    mBaseAddress = base;
+    mMappedSize = size;
+
+    return true;
+}
+
+} // namespace TinyMemoryPool
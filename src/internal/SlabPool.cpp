@@ -0,0 +1,367 @@
+#include "SlabPool.h"
+#include "Common.h"
+#include "MemoryManager.h"
+#include "PlatformMemory.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace TinyMemoryPool::Detail
+{
+
+void SlabPool::Initialize(std::size_t chunkSize, std::size_t initialBlockSize)
+{
+    TMP_ASSERT(std::has_single_bit(chunkSize));
+
+    mChunkSize = chunkSize;
+    mSpanSize = std::max(MIN_SPAN_SIZE, chunkSize * MIN_SLOTS_PER_SPAN);
+    mSlotCount = mSpanSize / chunkSize;
+    mFirstSlot = (sizeof(SlabSpan) + chunkSize - 1) / chunkSize;
+    mPageSize = PlatformMemory::GetPageSize();
+
+    TMP_ASSERT(mSlotCount <= SlabSpan::MAX_SLOTS);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const std::size_t spanCount = std::max<std::size_t>(1, (initialBlockSize + mSpanSize - 1) / mSpanSize);
+    for(std::size_t i = 0; i < spanCount; ++i)
+    {
+        SlabSpan* span = CreateSpan();
+        if(span == nullptr)
+            break; //  Pop  ٽ Ȯ õ
+
+        LinkBack(span, LIST_EMPTY);
+        ++mCommittedEmptyCount;
+    }
+}
+
+void SlabPool::Shutdown() noexcept
+{
+    // Ʈ .  ޸  MemoryManager /Ѵ.
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mPartialSpans = SpanList{};
+    mFullSpans = SpanList{};
+    mEmptySpans = SpanList{};
+    mCommittedEmptyCount = 0;
+    mSpans.clear();
+}
+
+[[nodiscard]] void* SlabPool::Pop()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    // Partial Ʈ   ϰ   Span
+    SlabSpan* span = mPartialSpans.Head;
+
+    if(span == nullptr)
+    {
+        span = AcquireSpan();
+        if(span == nullptr) [[unlikely]]
+            return nullptr;
+        LinkFront(span, LIST_PARTIAL);
+    }
+
+    void* ptr = TakeSlot(span);
+
+    if(span->UsedCount == mSlotCount - mFirstSlot)
+    {
+        Unlink(span);
+        LinkFront(span, LIST_FULL);
+    }
+
+    return ptr;
+}
+
+[[nodiscard]] void* SlabPool::PopNear(const void* hint)
+{
+    SlabSpan* span = GetSpan(hint);
+
+    const auto offset =
+        static_cast<std::size_t>(static_cast<const std::byte*>(hint) - reinterpret_cast<const std::byte*>(span));
+    const std::size_t hintSlot = offset / mChunkSize;
+
+    if(hintSlot < mFirstSlot || hintSlot >= mSlotCount)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    //  hint ٸ Ǯ ̰ų  ȯ Span  Ƿ,  б   Ǯ Span Ȯ
+    // (ϵ Span   ȯ ʴ´)
+    if(!std::binary_search(mSpans.begin(), mSpans.end(), span))
+        return nullptr;
+
+    // hint  ̹ Ǿ  ʴ´
+    if(span->FreeBits[hintSlot / 64] & (std::uint64_t{1} << (hintSlot % 64)))
+        return nullptr;
+
+    //   hint Ƿ Span Partial Ǵ Full. Full̸ ٸ Span ѱ
+    if(span->ListKind != LIST_PARTIAL)
+        return nullptr;
+
+    void* ptr = TakeSlotNear(span, hintSlot);
+
+    if(span->UsedCount == mSlotCount - mFirstSlot)
+    {
+        Unlink(span);
+        LinkFront(span, LIST_FULL);
+    }
+
+    return ptr;
+}
+
+void SlabPool::Push(void* ptr)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    ReleaseSlot(ptr);
+}
+
+void SlabPool::PushBatch(void* const* chunks, std::size_t count)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        ReleaseSlot(chunks[i]);
+    }
+}
+
+void SlabPool::ReleaseSlot(void* ptr) noexcept
+{
+    SlabSpan* span = GetSpan(ptr);
+    TMP_ASSERT(span->Owner == this);
+
+    const auto offset = static_cast<std::size_t>(static_cast<std::byte*>(ptr) - reinterpret_cast<std::byte*>(span));
+    const std::size_t slot = offset / mChunkSize;
+    TMP_ASSERT(slot >= mFirstSlot && slot < mSlotCount);
+
+    const std::uint64_t mask = std::uint64_t{1} << (slot % 64);
+    std::uint64_t& word = span->FreeBits[slot / 64];
+
+    if(word & mask) [[unlikely]]
+    {
+        TMP_FATAL_ERROR("Double free detected (SlabPool).");
+    }
+
+    const bool wasFull = (span->UsedCount == mSlotCount - mFirstSlot);
+
+    word |= mask;
+    --span->UsedCount;
+
+    if(span->UsedCount == 0)
+    {
+        Unlink(span);
+        RetireEmptySpan(span);
+    }
+    else if(wasFull)
+    {
+        // ݱ   ִ Span  ϹǷ Partial ʿ ξ  ä
+        Unlink(span);
+        LinkFront(span, LIST_PARTIAL);
+    }
+}
+
+[[nodiscard]] SlabSpan* SlabPool::GetSpan(const void* ptr) const noexcept
+{
+    const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+    return reinterpret_cast<SlabSpan*>(address & ~(static_cast<std::uintptr_t>(mSpanSize) - 1));
+}
+
+[[nodiscard]] SlabSpan* SlabPool::CreateSpan()
+{
+    // Span ũ  ξ ûũ ּҿ  O(1) ã  ִ
+    void* block = ::TinyMemoryPool::MemoryManager::GetInstance().AllocateBlock(mSpanSize, mSpanSize);
+    if(block == nullptr)
+        return nullptr;
+
+    auto* span = static_cast<SlabSpan*>(block);
+    std::memset(span, 0, sizeof(SlabSpan));
+    span->Owner = this;
+
+    mSpans.insert(std::upper_bound(mSpans.begin(), mSpans.end(), span), span);
+
+    for(std::size_t slot = mFirstSlot; slot < mSlotCount; ++slot)
+    {
+        span->FreeBits[slot / 64] |= std::uint64_t{1} << (slot % 64);
+    }
+
+    return span;
+}
+
+[[nodiscard]] SlabSpan* SlabPool::AcquireSpan()
+{
+    SlabSpan* span = mEmptySpans.Head;
+
+    if(span == nullptr)
+        return CreateSpan();
+
+    Unlink(span);
+
+    if(span->IsDecommitted)
+    {
+        PlatformMemory::Commit(reinterpret_cast<std::byte*>(span) + mPageSize, mSpanSize - mPageSize);
+        span->IsDecommitted = false;
+    }
+    else
+    {
+        --mCommittedEmptyCount;
+    }
+
+    return span;
+}
+
+[[nodiscard]] void* SlabPool::TakeSlot(SlabSpan* span) noexcept
+{
+    const std::size_t wordCount = mSlotCount / 64;
+
+    for(std::size_t i = 0; i < wordCount; ++i)
+    {
+        std::uint64_t& word = span->FreeBits[i];
+        if(word == 0)
+            continue;
+
+        // countr_zero: C++20 <bit>. κ TZCNT/BSF ϵ ɾ ȯ.
+        const std::size_t slot = i * 64 + static_cast<std::size_t>(std::countr_zero(word));
+        word &= word - 1;
+
+        ++span->UsedCount;
+
+        return reinterpret_cast<std::byte*>(span) + slot * mChunkSize;
+    }
+
+    TMP_ASSERT(false && "Span on the partial list has no free slot.");
+    return nullptr;
+}
+
+[[nodiscard]] void* SlabPool::TakeSlotNear(SlabSpan* span, std::size_t hintSlot) noexcept
+{
+    const std::size_t wordCount = mSlotCount / 64;
+    const std::size_t hintWord = hintSlot / 64;
+    const std::size_t hintBit = hintSlot % 64;
+
+    // hint  (64)   徿   Ž
+    for(std::size_t distance = 0; distance < wordCount; ++distance)
+    {
+        for(const std::size_t i : {hintWord - distance, hintWord + distance})
+        {
+            // hintWord - distance 0 ̸̸ size_t  wordCount ̻ Ǿ ǳʶ
+            if(i >= wordCount)
+                continue;
+
+            std::uint64_t& word = span->FreeBits[i];
+            if(word == 0)
+                continue;
+
+            //   hint Կ   Ʈ,   , Ʒ  ֻ Ʈ
+            const std::size_t target = (i == hintWord) ? hintBit : (i > hintWord) ? 0 : 63;
+            const std::uint64_t upper = word & (~std::uint64_t{0} << target);
+            const std::uint64_t lower = word & ~upper;
+
+            std::size_t bit = 0;
+            if(upper == 0)
+                bit = 63 - static_cast<std::size_t>(std::countl_zero(lower));
+            else if(lower == 0)
+                bit = static_cast<std::size_t>(std::countr_zero(upper));
+            else
+            {
+                const auto above = static_cast<std::size_t>(std::countr_zero(upper));
+                const auto below = 63 - static_cast<std::size_t>(std::countl_zero(lower));
+                bit = (above - target <= target - below) ? above : below;
+            }
+
+            word &= ~(std::uint64_t{1} << bit);
+            ++span->UsedCount;
+
+            return reinterpret_cast<std::byte*>(span) + (i * 64 + bit) * mChunkSize;
+        }
+    }
+
+    TMP_ASSERT(false && "Span on the partial list has no free slot.");
+    return nullptr;
+}
+
+void SlabPool::LinkFront(SlabSpan* span, ListKind kind) noexcept
+{
+    SpanList& list = GetList(kind);
+
+    span->ListKind = kind;
+    span->Prev = nullptr;
+    span->Next = list.Head;
+
+    if(list.Head)
+        list.Head->Prev = span;
+    else
+        list.Tail = span;
+
+    list.Head = span;
+    ++list.Count;
+}
+
+void SlabPool::LinkBack(SlabSpan* span, ListKind kind) noexcept
+{
+    SpanList& list = GetList(kind);
+
+    span->ListKind = kind;
+    span->Prev = list.Tail;
+    span->Next = nullptr;
+
+    if(list.Tail)
+        list.Tail->Next = span;
+    else
+        list.Head = span;
+
+    list.Tail = span;
+    ++list.Count;
+}
+
+void SlabPool::Unlink(SlabSpan* span) noexcept
+{
+    SpanList& list = GetList(static_cast<ListKind>(span->ListKind));
+
+    if(span->Prev)
+        span->Prev->Next = span->Next;
+    else
+        list.Head = span->Next;
+
+    if(span->Next)
+        span->Next->Prev = span->Prev;
+    else
+        list.Tail = span->Prev;
+
+    span->Prev = nullptr;
+    span->Next = nullptr;
+    --list.Count;
+}
+
+[[nodiscard]] SlabPool::SpanList& SlabPool::GetList(ListKind kind) noexcept
+{
+    switch(kind)
+    {
+        case LIST_PARTIAL:
+            return mPartialSpans;
+        case LIST_FULL:
+            return mFullSpans;
+        default:
+            return mEmptySpans;
+    }
+}
+
+void SlabPool::RetireEmptySpan(SlabSpan* span) noexcept
+{
+    if(mCommittedEmptyCount < RETAINED_EMPTY_SPANS)
+    {
+        LinkFront(span, LIST_EMPTY);
+        ++mCommittedEmptyCount;
+        return;
+    }
+
+    //  ִ ù    ޸𸮸 ȯ (ּ  ״  )
+    PlatformMemory::Decommit(reinterpret_cast<std::byte*>(span) + mPageSize, mSpanSize - mPageSize);
+    span->IsDecommitted = true;
+
+    LinkBack(span, LIST_EMPTY);
+}
+
+} // namespace TinyMemoryPool::Detail
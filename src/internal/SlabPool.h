@@ -0,0 +1,123 @@
+#pragma once
+
+#include "PoolBase.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace TinyMemoryPool::Detail
+{
+
+class SlabPool;
+
+/// @brief SlabPool ϴ Span . Span  ּ(Span ũ ĵ) ġѴ.
+/// @note ûũ ּҸ Span ũ  ϸ O(1)  ã  ִ.
+struct SlabSpan
+{
+    static constexpr std::size_t MAX_SLOTS = 1024;
+    static constexpr std::size_t BITMAP_WORDS = MAX_SLOTS / 64;
+
+    SlabPool* Owner;
+    SlabSpan* Prev;
+    SlabSpan* Next;
+    std::uint32_t UsedCount;     ///<    .
+    std::uint8_t ListKind;       ///<  Ҽӵ Ʈ (Partial/Full/Empty).
+    bool IsDecommitted;          ///<     ޸𸮸 OS ȯ .
+    std::uint64_t FreeBits[BITMAP_WORDS]; ///<   Ʈ. 1 = .
+};
+
+/// @brief Span   Ʈ ûũ ϴ  Ǯ (Pool ü 鿣).
+///   Ž countr_zero(TZCNT/BSF) 64 Ծ ˻Ѵ.
+/// Span Partial/Full/Empty Ʈ  ϰ   Span ä,
+///   ִ Span  OS ȯ  ִ. Ʈ п Double Free  ȴ.
+/// @note Ʈ  ʿϹǷ Ǯ  ؽ ȣѴ (Pool 񱳿 鿣).
+class SlabPool final : public PoolBase
+{
+  public:
+    SlabPool() noexcept : PoolBase(PoolBackend::Bitmap)
+    {
+    }
+    ~SlabPool() = default;
+
+    /// @brief Ǯ ʱȭϰ ù Span ҴѴ.
+    /// @param chunkSize  ûũ ũ (Byte, 2 ŵ).
+    /// @param initialBlockSize ʿ Ȯ ũ (Byte). Span ũ  øȴ.
+    void Initialize(std::size_t chunkSize, std::size_t initialBlockSize);
+
+    /// @brief Ʈ Ѵ.
+    /// @note  ޸  MemoryManager α׷   ϰ Ѵ.
+    void Shutdown() noexcept;
+
+    /// @brief  ûũ ϳ  (Thread-Safe).
+    /// @return ȿ ޸ ּ.  Span Ȯ ϸ(  ) nullptr.
+    [[nodiscard]] void* Pop();
+
+    /// @brief hint ûũ  Span,      (Thread-Safe).
+    /// @param hint  ּ.  Ǯ Span    ûũ  ,   ޸𸮴  ʴ´.
+    /// @return ûũ ּ. hint ȿ ʰų hint Span    nullptr (ȣ  Pop ü).
+    [[nodiscard]] void* PopNear(const void* hint);
+
+    /// @brief  Ϸ ûũ ݳѴ (Thread-Safe). Double Free  TMP_FATAL_ERROR .
+    void Push(void* ptr);
+
+    /// @brief  ûũ    ݳѴ (Thread-Safe).   Ǯ ûũ Ѵ.
+    void PushBatch(void* const* chunks, std::size_t count);
+
+    /// @brief ûũ  Span .
+    [[nodiscard]] SlabSpan* GetSpan(const void* ptr) const noexcept;
+
+  private:
+    struct SpanList
+    {
+        SlabSpan* Head = nullptr;
+        SlabSpan* Tail = nullptr;
+        std::size_t Count = 0;
+    };
+
+    enum ListKind : std::uint8_t
+    {
+        LIST_PARTIAL,
+        LIST_FULL,
+        LIST_EMPTY,
+    };
+
+    [[nodiscard]] SlabSpan* CreateSpan();
+    [[nodiscard]] SlabSpan* AcquireSpan();
+
+    [[nodiscard]] void* TakeSlot(SlabSpan* span) noexcept;
+    [[nodiscard]] void* TakeSlotNear(SlabSpan* span, std::size_t hintSlot) noexcept;
+
+    /// @brief   ǵ Span Ʈ Ѵ. mMutex  ¿ ȣ.
+    void ReleaseSlot(void* ptr) noexcept;
+
+    void LinkFront(SlabSpan* span, ListKind kind) noexcept;
+    void LinkBack(SlabSpan* span, ListKind kind) noexcept;
+    void Unlink(SlabSpan* span) noexcept;
+    [[nodiscard]] SpanList& GetList(ListKind kind) noexcept;
+
+    /// @brief   Span Empty Ʈ ű.     OS ȯѴ.
+    void RetireEmptySpan(SlabSpan* span) noexcept;
+
+  private:
+    static constexpr std::size_t MIN_SPAN_SIZE = 64 * 1024;
+    static constexpr std::size_t MIN_SLOTS_PER_SPAN = 64;
+    static constexpr std::size_t RETAINED_EMPTY_SPANS = 1; ///<  ϴ  Span  ( ).
+
+    std::size_t mSpanSize = 0;
+    std::size_t mFirstSlot = 0;  ///<  ϴ  .
+    std::size_t mSlotCount = 0;  ///<   Span ü  .
+    std::size_t mPageSize = 0;
+
+    SpanList mPartialSpans;
+    SpanList mFullSpans;
+    SpanList mEmptySpans;              ///<   Span , ȯ Span .
+    std::size_t mCommittedEmptyCount = 0;
+
+    std::vector<SlabSpan*> mSpans; ///<  Ǯ   Span (ּ ). PopNear hint .
+
+    std::mutex mMutex;
+};
+
+} // namespace TinyMemoryPool::Detail
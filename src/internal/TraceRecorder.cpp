@@ -0,0 +1,212 @@
+#include "TraceRecorder.h"
+#include "Common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+namespace TinyMemoryPool::Detail
+{
+
+namespace
+{
+
+///  ۰ Ҹ ڿ   ֵ Ҹڰ  Ÿ д (TLS Ҹ  ).
+thread_local bool isThreadBufferDestroyed = false;
+
+} // namespace
+
+/// @brief  ϳ ϴ SPSC  .
+/// ( )   Tail Ű, Һ(Drain) mDrainMutex ȭȴ.
+class TraceThreadBuffer final
+{
+  public:
+    static constexpr std::size_t CAPACITY = 4096; ///<  128KB.
+
+    TraceThreadBuffer()
+    {
+        TraceRecorder::GetInstance().Register(this);
+    }
+
+    ~TraceThreadBuffer()
+    {
+        isThreadBufferDestroyed = true;
+
+        Drain();
+        TraceRecorder::GetInstance().Unregister(this);
+    }
+
+    TraceThreadBuffer(const TraceThreadBuffer&) = delete;
+    TraceThreadBuffer& operator=(const TraceThreadBuffer&) = delete;
+
+    void Push(const TraceRecord& record)
+    {
+        const std::size_t tail = mTail.load(std::memory_order_relaxed);
+
+        if(tail - mHead.load(std::memory_order_acquire) == CAPACITY) [[unlikely]]
+        {
+            Drain();
+        }
+
+        mRecords[tail % CAPACITY] = record;
+        mTail.store(tail + 1, std::memory_order_release);
+    }
+
+    /// @brief  ڵ带 Ϸ .   Stop ʿ ȣ  ִ.
+    void Drain()
+    {
+        std::lock_guard<std::mutex> lock(mDrainMutex);
+
+        const std::size_t head = mHead.load(std::memory_order_relaxed);
+        const std::size_t tail = mTail.load(std::memory_order_acquire);
+
+        if(head == tail)
+            return;
+
+        //         
+        const std::size_t begin = head % CAPACITY;
+        const std::size_t firstCount = std::min(tail - head, CAPACITY - begin);
+
+        TraceRecorder& recorder = TraceRecorder::GetInstance();
+        recorder.WriteRecords(mRecords + begin, firstCount);
+        recorder.WriteRecords(mRecords, (tail - head) - firstCount);
+
+        mHead.store(tail, std::memory_order_release);
+    }
+
+    [[nodiscard]] std::uint32_t GetThreadId() const noexcept
+    {
+        return mThreadId;
+    }
+
+  private:
+    std::uint32_t mThreadId = TraceRecorder::GetInstance().mNextThreadId.fetch_add(1, std::memory_order_relaxed);
+
+    std::atomic<std::size_t> mHead = 0;
+    std::atomic<std::size_t> mTail = 0;
+    std::mutex mDrainMutex;
+
+    TraceRecord mRecords[CAPACITY];
+};
+
+TraceRecorder& TraceRecorder::GetInstance()
+{
+    static TraceRecorder instance;
+    return instance;
+}
+
+TraceRecorder::~TraceRecorder()
+{
+    Stop();
+}
+
+bool TraceRecorder::Start(const std::string& path)
+{
+    std::lock_guard<std::mutex> registryLock(mRegistryMutex);
+    std::lock_guard<std::mutex> fileLock(mFileMutex);
+
+    if(mFile != nullptr)
+    {
+        return false;
+    }
+
+    mFile = std::fopen(path.c_str(), "wb");
+    if(mFile == nullptr)
+    {
+        return false;
+    }
+
+    const TraceFileHeader header = {TraceFileHeader::MAGIC, TraceFileHeader::VERSION, sizeof(TraceRecord)};
+    std::fwrite(&header, sizeof(header), 1, mFile);
+
+    mIsRecording.store(true, std::memory_order_release);
+    return true;
+}
+
+void TraceRecorder::Stop()
+{
+    std::lock_guard<std::mutex> registryLock(mRegistryMutex);
+
+    if(!mIsRecording.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    for(TraceThreadBuffer* buffer : mBuffers)
+    {
+        buffer->Drain();
+    }
+
+    std::lock_guard<std::mutex> fileLock(mFileMutex);
+
+    std::fclose(mFile);
+    mFile = nullptr;
+}
+
+void TraceRecorder::Record(TraceOp op, const void* ptr, std::size_t size)
+{
+    if(isThreadBufferDestroyed) [[unlikely]]
+        return; // ٸ TLS Ҹڿ ȣ (۰ ̹ )
+
+    // 128KB ۸ TLS   ʰ  д.    Ҹڰ   .
+    thread_local std::unique_ptr<TraceThreadBuffer> buffer = std::make_unique<TraceThreadBuffer>();
+
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+
+    TraceRecord record = {};
+    record.TimestampNs = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    record.Id = reinterpret_cast<std::uint64_t>(ptr);
+    record.Size = size;
+    record.ThreadId = buffer->GetThreadId();
+    record.Op = op;
+
+    buffer->Push(record);
+}
+
+void TraceRecorder::Register(TraceThreadBuffer* buffer)
+{
+    std::lock_guard<std::mutex> lock(mRegistryMutex);
+    mBuffers.push_back(buffer);
+}
+
+void TraceRecorder::Unregister(TraceThreadBuffer* buffer)
+{
+    std::lock_guard<std::mutex> lock(mRegistryMutex);
+    mBuffers.erase(std::remove(mBuffers.begin(), mBuffers.end(), buffer), mBuffers.end());
+}
+
+void TraceRecorder::WriteRecords(const TraceRecord* records, std::size_t count)
+{
+    if(count == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(mFileMutex);
+
+    if(mFile != nullptr)
+    {
+        std::fwrite(records, sizeof(TraceRecord), count, mFile);
+    }
+}
+
+} // namespace TinyMemoryPool::Detail
+
+namespace TinyMemoryPool
+{
+
+bool StartTraceRecording([[maybe_unused]] const std::string& path)
+{
+#if TMP_ENABLE_TRACE
+    return Detail::TraceRecorder::GetInstance().Start(path);
+#else
+    return false;
+#endif
+}
+
+void StopTraceRecording()
+{
+#if TMP_ENABLE_TRACE
+    Detail::TraceRecorder::GetInstance().Stop();
+#endif
+}
+
+} // namespace TinyMemoryPool
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <TinyMemoryPool/Trace.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if !defined(TMP_ENABLE_TRACE)
+#define TMP_ENABLE_TRACE 0
+#endif
+
+/// @brief 긴 Լ ϴ  ũ. TMP_ENABLE_TRACE=0̸ ڵ尡  ʴ´.
+#if TMP_ENABLE_TRACE
+#define TMP_TRACE_RECORD(op, ptr, size)                                                                                \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        auto& recorder = ::TinyMemoryPool::Detail::TraceRecorder::GetInstance();                                       \
+        if(recorder.IsRecording()) [[unlikely]]                                                                        \
+            recorder.Record(op, ptr, size);                                                                            \
+    } while(0)
+#else
+#define TMP_TRACE_RECORD(op, ptr, size) ((void) 0)
+#endif
+
+namespace TinyMemoryPool::Detail
+{
+
+class TraceThreadBuffer;
+
+/// @brief Ҵ 긴 ȣ ̳ʸ Ʈ̽ Ϸ ϴ ڴ.
+///  庰 SPSC  ۿ   ̰, ۰  ų  /Stop ÿ Ϸ .
+/// Meyers Singleton.
+class TraceRecorder final
+{
+  public:
+    static TraceRecorder& GetInstance();
+
+    bool Start(const std::string& path);
+    void Stop();
+
+    [[nodiscard]] bool IsRecording() const noexcept
+    {
+        return mIsRecording.load(std::memory_order_relaxed);
+    }
+
+    /// @brief   ۿ  ߰Ѵ (Lock-Free, ۰    ).
+    void Record(TraceOp op, const void* ptr, std::size_t size);
+
+  private:
+    friend class TraceThreadBuffer;
+
+    TraceRecorder() = default;
+    ~TraceRecorder();
+
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    void Register(TraceThreadBuffer* buffer);
+    void Unregister(TraceThreadBuffer* buffer);
+
+    /// @brief Ͽ ڵ带 Ѵ.   ƴϸ .
+    void WriteRecords(const TraceRecord* records, std::size_t count);
+
+  private:
+    std::atomic<bool> mIsRecording = false;
+    std::atomic<std::uint32_t> mNextThreadId = 0;
+
+    std::mutex mRegistryMutex; ///<   /  Stop  ü Flush (Cold Path).
+    std::vector<TraceThreadBuffer*> mBuffers;
+
+    std::mutex mFileMutex;
+    std::FILE* mFile = nullptr;
+};
+
+} // namespace TinyMemoryPool::Detail
@@ -4,7 +4,9 @@
 
 #include "Common.h"
 
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include <cstddef>
@@ -32,6 +34,16 @@ class PosixMemory final
         }
     }
 
+    static inline void Decommit(void* ptr, std::size_t size) noexcept
+    {
+        // MADV_DONTNEED:    ȯϰ,    0 ä  ޴´
+        int result = madvise(ptr, size, MADV_DONTNEED);
+        if(result != 0)
+        {
+            TMP_FATAL_ERROR("madvise failed!");
+        }
+    }
+
     static inline void Release(void* ptr, std::size_t size) noexcept
     {
         int result = munmap(ptr, size);
@@ -41,6 +53,108 @@ class PosixMemory final
         }
     }
 
+    /// @brief  ( ) MAP_SHARED Ѵ.
+    /// @param size [in] ּ ũ, [out]  ε ũ (   ũ  ũ).
+    /// @param preferredBase  ּ (Ʈ). Ŀ ٸ ּҸ   ִ.
+    /// @param isNewFile   Ǿų  ־ .
+    [[nodiscard]] static inline void* MapFileOrNull(const char* path, std::size_t& size, void* preferredBase,
+                                                    bool& isNewFile) noexcept
+    {
+        int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if(fd < 0)
+        {
+            return nullptr;
+        }
+
+        struct stat fileStat = {};
+        if(fstat(fd, &fileStat) != 0)
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        const auto fileSize = static_cast<std::size_t>(fileStat.st_size);
+        isNewFile = (fileSize == 0);
+
+        if(fileSize < size)
+        {
+            if(ftruncate(fd, static_cast<off_t>(size)) != 0)
+            {
+                close(fd);
+                return nullptr;
+            }
+        }
+        else
+        {
+            size = fileSize;
+        }
+
+        void* ptr = mmap(preferredBase, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd); //  fd ݾƵ ȴ
+
+        return (ptr == MAP_FAILED) ? nullptr : ptr;
+    }
+
+    /// @brief ̸ ִ  ޸ ü(shm_open) ϰų  MAP_SHARED Ѵ.
+    /// @param name '/' ϴ  ޸ ̸.
+    /// @param size [in]   ũ, [out]  ε ũ (  ü ũ).
+    /// @param create true   (̹ ϸ ), false  ü .
+    [[nodiscard]] static inline void* MapSharedOrNull(const char* name, std::size_t& size, bool create) noexcept
+    {
+        int fd = shm_open(name, create ? (O_RDWR | O_CREAT | O_EXCL) : O_RDWR, 0600);
+        if(fd < 0)
+        {
+            return nullptr;
+        }
+
+        bool isSized = true;
+        if(create)
+        {
+            isSized = (ftruncate(fd, static_cast<off_t>(size)) == 0);
+        }
+        else
+        {
+            struct stat objectStat = {};
+            isSized = (fstat(fd, &objectStat) == 0);
+            size = static_cast<std::size_t>(objectStat.st_size);
+        }
+
+        void* ptr = isSized ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+        close(fd);
+
+        if(ptr == MAP_FAILED)
+        {
+            if(create)
+            {
+                shm_unlink(name);
+            }
+            return nullptr;
+        }
+
+        return ptr;
+    }
+
+    /// @brief  ޸ ̸ Ѵ. ̹  μ      ִ.
+    static inline bool UnlinkShared(const char* name) noexcept
+    {
+        return shm_unlink(name) == 0;
+    }
+
+    /// @brief     ũ ȭѴ.
+    static inline void FlushFile(void* ptr, std::size_t size) noexcept
+    {
+        int result = msync(ptr, size, MS_SYNC);
+        if(result != 0)
+        {
+            TMP_FATAL_ERROR("msync failed!");
+        }
+    }
+
+    static inline void UnmapFile(void* ptr, std::size_t size) noexcept
+    {
+        Release(ptr, size);
+    }
+
     static inline std::size_t GetPageSize() noexcept
     {
         return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
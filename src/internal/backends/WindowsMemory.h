@@ -30,6 +30,15 @@ class WindowsMemory final
         }
     }
 
+    static inline void Decommit(void* ptr, std::size_t size) noexcept
+    {
+        BOOL success = VirtualFree(ptr, size, MEM_DECOMMIT);
+        if(success == FALSE)
+        {
+            TMP_FATAL_ERROR("VirtualFree decommit failed!");
+        }
+    }
+
     static inline void Release(void* ptr, [[maybe_unused]] std::size_t size) noexcept
     {
         BOOL success = VirtualFree(ptr, 0, MEM_RELEASE);
@@ -39,6 +48,119 @@ class WindowsMemory final
         }
     }
 
+    /// @brief  ( )    Ѵ.
+    /// @param size [in] ּ ũ, [out]  ε ũ (   ũ  ũ).
+    /// @param preferredBase  ּ. ش ּҰ  ̸  ּҷ Ѵ.
+    /// @param isNewFile   Ǿų  ־ .
+    [[nodiscard]] static inline void* MapFileOrNull(const char* path, std::size_t& size, void* preferredBase,
+                                                    bool& isNewFile) noexcept
+    {
+        HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                                  OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if(file == INVALID_HANDLE_VALUE)
+        {
+            return nullptr;
+        }
+
+        LARGE_INTEGER fileSize = {};
+        if(GetFileSizeEx(file, &fileSize) == FALSE)
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        isNewFile = (fileSize.QuadPart == 0);
+        if(static_cast<std::size_t>(fileSize.QuadPart) > size)
+        {
+            size = static_cast<std::size_t>(fileSize.QuadPart);
+        }
+
+        const auto mappingSize = static_cast<unsigned long long>(size);
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(mappingSize >> 32),
+                                            static_cast<DWORD>(mappingSize & 0xFFFFFFFF), nullptr);
+        CloseHandle(file);
+        if(mapping == nullptr)
+        {
+            return nullptr;
+        }
+
+        void* ptr = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size, preferredBase);
+        if(ptr == nullptr && preferredBase != nullptr)
+        {
+            ptr = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size, nullptr);
+        }
+        CloseHandle(mapping); // 䰡  ü  Ѵ
+
+        return ptr;
+    }
+
+    /// @brief ̸ ִ   ü(¡  ) ϰų  Ѵ.
+    /// @param name  ޸ ̸ (: "Local\\MyPool").
+    /// @param size [in]   ũ, [out]  ε ũ.
+    /// @param create true   (̹ ϸ ), false  ü .
+    [[nodiscard]] static inline void* MapSharedOrNull(const char* name, std::size_t& size, bool create) noexcept
+    {
+        HANDLE mapping = nullptr;
+        if(create)
+        {
+            const auto mappingSize = static_cast<unsigned long long>(size);
+            mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                         static_cast<DWORD>(mappingSize >> 32),
+                                         static_cast<DWORD>(mappingSize & 0xFFFFFFFF), name);
+            if(mapping != nullptr && GetLastError() == ERROR_ALREADY_EXISTS)
+            {
+                CloseHandle(mapping);
+                return nullptr;
+            }
+        }
+        else
+        {
+            mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name);
+        }
+
+        if(mapping == nullptr)
+        {
+            return nullptr;
+        }
+
+        void* ptr = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, create ? size : 0);
+        CloseHandle(mapping); // 䰡  ü  Ѵ
+
+        if(ptr != nullptr && !create)
+        {
+            MEMORY_BASIC_INFORMATION info = {};
+            VirtualQuery(ptr, &info, sizeof(info));
+            size = info.RegionSize;
+        }
+
+        return ptr;
+    }
+
+    /// @brief Windows ̸ ִ  ü  ڵ/䰡   ڵ ŵȴ.
+    static inline bool UnlinkShared([[maybe_unused]] const char* name) noexcept
+    {
+        return true;
+    }
+
+    /// @brief     ũ ȭѴ.
+    static inline void FlushFile(void* ptr, std::size_t size) noexcept
+    {
+        BOOL success = FlushViewOfFile(ptr, size);
+        if(success == FALSE)
+        {
+            TMP_FATAL_ERROR("FlushViewOfFile failed!");
+        }
+    }
+
+    static inline void UnmapFile(void* ptr, [[maybe_unused]] std::size_t size) noexcept
+    {
+        BOOL success = UnmapViewOfFile(ptr);
+        if(success == FALSE)
+        {
+            TMP_FATAL_ERROR("UnmapViewOfFile failed!");
+        }
+    }
+
     static inline std::size_t GetPageSize() noexcept
     {
         SYSTEM_INFO sysInfo;
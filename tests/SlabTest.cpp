@@ -0,0 +1,549 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <TinyMemoryPool/Allocator.h>
+#include <TinyMemoryPool/LocalityAllocator.h>
+#include <TinyMemoryPool/Reclaim.h>
+
+//    ˻ϴ ȭƮڽ ׽Ʈ (src/internal  )
+#include "MemoryManager.h"
+#include "Pool.h"
+#include "PoolManager.h"
+#include "SlabPool.h"
+
+using namespace TinyMemoryPool;
+
+//  ũ Ŭ Ʈ  ϴ ̺귯 (TMP_BITMAP_POOL_MASK=0x7F) ũȴ.
+// : TMP_SlabTest [--double-free | --region-cap]  (ɼ  / Ȯο ڽ μ )
+
+class Timer
+{
+    std::string m_name;
+    std::chrono::high_resolution_clock::time_point m_start;
+
+  public:
+    Timer(std::string name) : m_name(name), m_start(std::chrono::high_resolution_clock::now())
+    {
+    }
+    ~Timer()
+    {
+        auto end = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double, std::milli> diff = end - m_start;
+        std::cout << "[" << m_name << "] : " << diff.count() << " ms" << std::endl;
+    }
+};
+
+void TestSlabChurn()
+{
+    std::cout << "=== 1. Slab Multi-Thread Churn Test (All Size Classes) ===" << std::endl;
+
+    constexpr int THREAD_COUNT = 4;
+    constexpr int ROUND_COUNT = 10;
+    constexpr std::size_t BLOCK_COUNT = 4096;
+
+    std::vector<std::thread> threads;
+    std::vector<int> failures(THREAD_COUNT, 0);
+
+    for(int t = 0; t < THREAD_COUNT; ++t)
+    {
+        threads.emplace_back([t, &failures]() {
+            Allocator<unsigned char> alloc;
+            std::vector<std::pair<unsigned char*, std::size_t>> blocks;
+            blocks.reserve(BLOCK_COUNT);
+
+            for(int round = 0; round < ROUND_COUNT; ++round)
+            {
+                for(std::size_t i = 0; i < BLOCK_COUNT; ++i)
+                {
+                    const std::size_t size = 16 + (i * 61) % 3985;
+                    unsigned char* p = alloc.allocate(size);
+                    std::memset(p, static_cast<int>(t + i), size);
+                    blocks.emplace_back(p, size);
+                }
+
+                for(std::size_t i = 0; i < blocks.size(); ++i)
+                {
+                    auto [p, size] = blocks[i];
+                    const auto expected = static_cast<unsigned char>(t + i);
+                    if(p[0] != expected || p[size / 2] != expected || p[size - 1] != expected)
+                        ++failures[t];
+                }
+
+                // Ȧ ° , ¦ °   Partial/Full/Empty ̰ ̵ 
+                for(std::size_t i = 1; i < blocks.size(); i += 2)
+                {
+                    alloc.deallocate(blocks[i].first, blocks[i].second);
+                }
+                for(std::size_t i = blocks.size() & ~std::size_t{1}; i >= 2;)
+                {
+                    i -= 2;
+                    alloc.deallocate(blocks[i].first, blocks[i].second);
+                }
+                blocks.clear();
+            }
+        });
+    }
+
+    for(auto& thread : threads)
+        thread.join();
+
+    for(int failure : failures)
+    {
+        if(failure != 0)
+            throw std::runtime_error("Slab churn corrupted blocks");
+    }
+
+    std::cout << "-> " << THREAD_COUNT << " threads x " << ROUND_COUNT << " rounds x " << BLOCK_COUNT
+              << " blocks without corruption." << std::endl
+              << std::endl;
+}
+
+void TestSpanRelease()
+{
+    std::cout << "=== 2. Empty Span Release Test ===" << std::endl;
+
+    constexpr std::size_t CHUNK_SIZE = 256;
+    constexpr std::size_t CHUNK_COUNT = 4096; // 64KB Span   ġ
+
+    Detail::SlabPool pool;
+    pool.Initialize(CHUNK_SIZE, 64 * 1024);
+
+    std::vector<void*> chunks;
+    std::set<Detail::SlabSpan*> spans;
+    for(std::size_t i = 0; i < CHUNK_COUNT; ++i)
+    {
+        void* p = pool.Pop();
+        if(p == nullptr)
+            throw std::runtime_error("SlabPool::Pop failed");
+        std::memset(p, 0xCD, CHUNK_SIZE);
+        chunks.push_back(p);
+        spans.insert(pool.GetSpan(p));
+    }
+
+    for(void* p : chunks)
+        pool.Push(p);
+
+    std::size_t decommitted = 0;
+    for(Detail::SlabSpan* span : spans)
+    {
+        if(span->UsedCount != 0)
+            throw std::runtime_error("Span still counts used slots after all chunks were freed");
+        if(span->IsDecommitted)
+            ++decommitted;
+    }
+
+    std::cout << "Spans used: " << spans.size() << ", decommitted after free: " << decommitted << std::endl;
+
+    //   ϴ 1   Span  OS ȯǾ 
+    if(decommitted != spans.size() - 1)
+        throw std::runtime_error("Empty spans were not released to the OS");
+
+    // ȯ Span ٽ  ٽ ĿԵǾ   ־ 
+    chunks.clear();
+    for(std::size_t i = 0; i < CHUNK_COUNT; ++i)
+    {
+        void* p = pool.Pop();
+        std::memset(p, 0xEF, CHUNK_SIZE);
+        chunks.push_back(p);
+    }
+    for(void* p : chunks)
+        pool.Push(p);
+
+    pool.Shutdown();
+    std::cout << "-> Fully free spans return their pages and recommit on reuse." << std::endl << std::endl;
+}
+
+void TestDoubleFreeDetection(const char* selfPath)
+{
+    std::cout << "=== 3. Double Free Detection Test ===" << std::endl;
+
+    //   TMP_FATAL_ERROR ϹǷ ڽ μ ϰ  Ḧ Ȯ
+    const std::string command = std::string("\"") + selfPath + "\" --double-free";
+    const int result = std::system(command.c_str());
+
+    if(result == 0)
+        throw std::runtime_error("Double free was not detected");
+
+    std::cout << "-> Double free terminated the child process (status " << result << ")." << std::endl
+              << std::endl;
+}
+
+int RunDoubleFree()
+{
+    Allocator<int> alloc;
+    int* p = alloc.allocate(4);
+    alloc.deallocate(p, 4);
+    alloc.deallocate(p, 4); // ⼭ Ǿ 
+
+    std::cerr << "Double free was not detected" << std::endl;
+    return 0;
+}
+
+/// @brief  ۾ Free List Pool SlabPool  Ѵ.
+template <typename PoolType>
+void RunPoolWorkload(PoolType& pool, std::vector<void*>& chunks)
+{
+    constexpr int ROUND_COUNT = 20;
+
+    for(int round = 0; round < ROUND_COUNT; ++round)
+    {
+        for(void*& p : chunks)
+        {
+            p = pool.Pop();
+            static_cast<unsigned char*>(p)[0] = 1;
+        }
+        //  ǳʶٸ  Span κ 񵵷    
+        for(std::size_t i = 0; i < chunks.size(); i += 2)
+            pool.Push(chunks[i]);
+        for(std::size_t i = 1; i < chunks.size(); i += 2)
+            pool.Push(chunks[i]);
+    }
+}
+
+void TestPoolComparison()
+{
+    std::cout << "=== 4. Free List Pool vs SlabPool ===" << std::endl;
+
+    constexpr std::size_t CHUNK_SIZE = 64;
+    std::vector<void*> chunks(100'000);
+
+    {
+        Detail::Pool pool;
+        pool.Initialize(CHUNK_SIZE, 64 * 1024);
+        {
+            Timer t("Free List Pool (64B, 20 rounds x 100k)");
+            RunPoolWorkload(pool, chunks);
+        }
+        pool.Shutdown();
+        std::cout << "  pages released after free: none (free list cannot tell which chunks are free)" << std::endl;
+    }
+
+    {
+        Detail::SlabPool pool;
+        pool.Initialize(CHUNK_SIZE, 64 * 1024);
+        {
+            Timer t("SlabPool (64B, 20 rounds x 100k)");
+            RunPoolWorkload(pool, chunks);
+        }
+
+        std::set<Detail::SlabSpan*> spans;
+        for(void* p : chunks)
+            spans.insert(pool.GetSpan(p));
+
+        std::size_t decommitted = 0;
+        for(Detail::SlabSpan* span : spans)
+            decommitted += span->IsDecommitted ? 1 : 0;
+
+        pool.Shutdown();
+        std::cout << "  pages released after free: " << decommitted << " / " << spans.size() << " spans" << std::endl;
+
+        if(decommitted == 0)
+            throw std::runtime_error("SlabPool kept every empty span committed");
+    }
+
+    std::cout << std::endl;
+}
+
+void TestLocalityPlacement()
+{
+    std::cout << "=== 5. Locality-Hinted Placement Test ===" << std::endl;
+
+    constexpr int NODE_COUNT = 10000;
+    constexpr int CHILD_COUNT = 16;
+    constexpr std::uintptr_t PAGE_MASK = ~static_cast<std::uintptr_t>(4095);
+
+    //   ¿ θ     ؾ 
+    LocalityAllocator<long long> alloc;
+    std::vector<long long*> fillers;
+    for(int i = 0; i < NODE_COUNT; ++i)
+        fillers.push_back(alloc.allocate(1, nullptr));
+    for(std::size_t i = 1; i < fillers.size(); i += 2)
+        alloc.deallocate(fillers[i], 1);
+
+    const long long* parent = fillers[NODE_COUNT / 2];
+    std::vector<long long*> children;
+    int samePage = 0;
+    for(int i = 0; i < CHILD_COUNT; ++i)
+    {
+        long long* child = alloc.allocate(1, parent);
+        *child = i;
+        children.push_back(child);
+
+        if((reinterpret_cast<std::uintptr_t>(child) & PAGE_MASK) ==
+           (reinterpret_cast<std::uintptr_t>(parent) & PAGE_MASK))
+            ++samePage;
+    }
+
+    std::cout << "Children on the parent's page: " << samePage << " / " << CHILD_COUNT << std::endl;
+    if(samePage != CHILD_COUNT)
+        throw std::runtime_error("AllocateNear did not place children on the parent's page");
+
+    for(long long* child : children)
+        alloc.deallocate(child, 1);
+    for(std::size_t i = 0; i < fillers.size(); i += 2)
+        alloc.deallocate(fillers[i], 1);
+
+    //  hint:  Ǿ  ȯ Span ѵ  ʰ Ϲ Ҵ üؾ 
+    long long* stale = alloc.allocate(1, fillers.back());
+    *stale = 42;
+    alloc.deallocate(stale, 1);
+
+    // ȭƮڽ:  , ȯ Span,  Ǯ  ƴ ּҴ  ź
+    {
+        constexpr std::size_t CHUNK_SIZE = 64;
+
+        Detail::SlabPool pool;
+        pool.Initialize(CHUNK_SIZE, 64 * 1024);
+
+        std::vector<void*> chunks;
+        for(std::size_t i = 0; i < 4096; ++i)
+            chunks.push_back(pool.Pop());
+
+        void* live = chunks[1];
+        for(std::size_t i = 2; i < chunks.size(); ++i)
+            pool.Push(chunks[i]);
+
+        const bool spanReleased = pool.GetSpan(chunks.back())->IsDecommitted;
+        const int foreign = 0;
+
+        if(pool.PopNear(chunks[2]) != nullptr || pool.PopNear(chunks.back()) != nullptr ||
+           pool.PopNear(&foreign) != nullptr)
+            throw std::runtime_error("PopNear followed a stale or foreign hint");
+
+        void* placed = pool.PopNear(live);
+        if(placed == nullptr || pool.GetSpan(placed) != pool.GetSpan(live))
+            throw std::runtime_error("PopNear ignored a live hint");
+
+        pool.Push(placed);
+        pool.Push(live);
+        pool.Push(chunks[0]);
+        pool.Shutdown();
+
+        std::cout << "Stale hints rejected (hint span released: " << (spanReleased ? "yes" : "no") << ")"
+                  << std::endl;
+    }
+
+    std::cout << "-> Hinted children share the parent's page; stale hints fall back safely." << std::endl
+              << std::endl;
+}
+
+void TestEpochReuse()
+{
+    std::cout << "=== 7. Epoch Reclamation with Immediate Slot Reuse ===" << std::endl;
+
+    struct StackNode
+    {
+        std::uint64_t Magic;
+        StackNode* Next;
+    };
+
+    constexpr std::uint64_t LIVE_MAGIC = 0x45444F4E4556494C; // "LIVENODE"
+    constexpr int OP_COUNT = 100000;
+    constexpr int MAX_DEPTH = 32;
+
+    Allocator<StackNode> alloc;
+    std::atomic<StackNode*> head = nullptr;
+    std::atomic<bool> done = false;
+    std::atomic<int> corrupted = 0;
+
+    //  ȿ   带  ӹ б 
+    std::thread reader([&]() {
+        while(!done.load(std::memory_order_acquire))
+        {
+            EpochGuard guard;
+            StackNode* top = head.load(std::memory_order_acquire);
+
+            const auto holdUntil = std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
+            do
+            {
+                int depth = 0;
+                for(StackNode* node = top; node && depth < MAX_DEPTH; node = node->Next, ++depth)
+                {
+                    //   Next  ʴ´
+                    if(node->Magic != LIVE_MAGIC)
+                    {
+                        corrupted.fetch_add(1, std::memory_order_relaxed);
+                        break;
+                    }
+                }
+            } while(std::chrono::steady_clock::now() < holdUntil);
+        }
+    });
+
+    //    Span   Ժ ֹǷ,  ȸ  ٷ  Ҵ翡 
+    for(int i = 0; i < OP_COUNT; ++i)
+    {
+        StackNode* node = alloc.allocate(1);
+        *node = StackNode{LIVE_MAGIC, head.load(std::memory_order_relaxed)};
+        head.store(node, std::memory_order_release);
+
+        if((i + 1) % MAX_DEPTH != 0)
+            continue;
+
+        while(StackNode* top = head.load(std::memory_order_relaxed))
+        {
+            head.store(top->Next, std::memory_order_release);
+            Retire(top, sizeof(StackNode));
+
+            StackNode* scribble = alloc.allocate(1);
+            std::memset(scribble, 0, sizeof(StackNode));
+            alloc.deallocate(scribble, 1);
+        }
+    }
+
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    for(StackNode* node = head.exchange(nullptr); node;)
+    {
+        StackNode* next = node->Next;
+        Retire(node, sizeof(StackNode));
+        node = next;
+    }
+
+    const std::size_t pending = TryReclaim();
+    std::cout << "Corrupted reads: " << corrupted.load() << ", pending after reclaim: " << pending << std::endl;
+
+    if(corrupted.load() != 0)
+        throw std::runtime_error("Retired node was reclaimed while a reader held it");
+    if(pending != 0)
+        throw std::runtime_error("Retired nodes were not reclaimed after the reader left");
+
+    std::cout << "-> Readers never saw a reused slot." << std::endl << std::endl;
+}
+
+void TestRegionChaining(const char* selfPath)
+{
+    std::cout << "=== 6. Region Chaining & Reserve Cap Test ===" << std::endl;
+
+    //  /  ù Ҵ  ǹǷ ڽ μ 
+    const std::string command = std::string("\"") + selfPath + "\" --region-cap";
+    const int result = std::system(command.c_str());
+
+    if(result != 0)
+        throw std::runtime_error("Region chaining test failed in the child process");
+
+    std::cout << "-> Extra regions are chained and the cap fails allocations with std::bad_alloc." << std::endl
+              << std::endl;
+}
+
+int RunRegionCap()
+{
+    constexpr std::size_t REGION_SIZE = 4 * 1024 * 1024;
+    constexpr std::size_t MAX_RESERVE_SIZE = 32 * 1024 * 1024;
+    constexpr std::size_t BLOCK_SIZE = 4000; // 4KB Ŭ
+
+    MemoryManagerConfig config;
+    config.TotalReserveSize = REGION_SIZE;
+    config.MaxReserveSize = MAX_RESERVE_SIZE;
+
+    try
+    {
+        if(!Detail::EngineConfigure(config))
+            throw std::runtime_error("EngineConfigure rejected the config before first use");
+
+        auto& memoryManager = MemoryManager::GetInstance();
+        Allocator<unsigned char> alloc;
+        std::vector<unsigned char*> blocks;
+
+        bool isCapReached = false;
+        while(!isCapReached)
+        {
+            try
+            {
+                unsigned char* p = alloc.allocate(BLOCK_SIZE);
+                p[0] = p[BLOCK_SIZE - 1] = 0x5A;
+                blocks.push_back(p);
+            }
+            catch(const std::bad_alloc&)
+            {
+                isCapReached = true;
+            }
+
+            if(blocks.size() > MAX_RESERVE_SIZE / 4096)
+                throw std::runtime_error("Allocations exceeded the reserve cap");
+        }
+
+        const std::size_t regionCount = memoryManager.GetRegionCount();
+        std::cout << "Regions: " << regionCount << ", 4KB blocks until cap: " << blocks.size() << std::endl;
+
+        if(regionCount < 2 || blocks.size() <= REGION_SIZE / 4096)
+            throw std::runtime_error("No additional region was chained");
+
+        const int onStack = 0;
+        void* onHeap = std::malloc(64);
+        const bool isOutsideTracked = memoryManager.Contains(&onStack) || memoryManager.Contains(onHeap);
+        std::free(onHeap);
+        if(isOutsideTracked)
+            throw std::runtime_error("Contains reported an address outside every region");
+
+        for(unsigned char* p : blocks)
+        {
+            if(!memoryManager.Contains(p) || p[0] != 0x5A || p[BLOCK_SIZE - 1] != 0x5A)
+                throw std::runtime_error("Block in a chained region is not tracked or was corrupted");
+        }
+
+        // ѿ  ڿ   API   nullptr  
+        if(Detail::EngineAllocate(BLOCK_SIZE) != nullptr)
+            throw std::runtime_error("Engine allocated past the reserve cap");
+
+        // Free List Pool Ȯ   nullptr  
+        Detail::Pool pool;
+        pool.Initialize(64, 64 * 1024);
+        if(pool.Pop() != nullptr)
+            throw std::runtime_error("Free list pool allocated past the reserve cap");
+        pool.Shutdown();
+
+        for(unsigned char* p : blocks)
+            alloc.deallocate(p, BLOCK_SIZE);
+
+        //  ûũ ٽ   ־ 
+        alloc.deallocate(alloc.allocate(BLOCK_SIZE), BLOCK_SIZE);
+
+        if(Detail::EngineConfigure(config))
+            throw std::runtime_error("EngineConfigure accepted a config after first use");
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << "Exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    if(argc >= 2 && std::string(argv[1]) == "--double-free")
+        return RunDoubleFree();
+    if(argc >= 2 && std::string(argv[1]) == "--region-cap")
+        return RunRegionCap();
+
+    try
+    {
+        // Ǯ MemoryManager  ʱȭ ( Pool/SlabPool MemoryManager  )
+        Detail::PoolManager::GetInstance();
+
+        TestSlabChurn();
+        TestSpanRelease();
+        TestDoubleFreeDetection(argv[0]);
+        TestPoolComparison();
+        TestLocalityPlacement();
+        TestRegionChaining(argv[0]);
+        TestEpochReuse();
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << "Exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,233 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <TinyMemoryPool/Detail/MemoryApi.h>
+#include <TinyMemoryPool/Trace.h>
+
+#if defined(TMP_HAVE_TBBMALLOC)
+#include <tbb/scalable_allocator.h>
+#endif
+
+#if defined(_WIN32)
+#include <Windows.h>
+#include <psapi.h>
+#elif defined(__linux__)
+#include <unistd.h>
+#endif
+
+using namespace TinyMemoryPool;
+
+// : TMP_TraceReplay <trace file> [tmp|malloc|tbb|all]
+// StartTraceRecording  Ʈ̽  Ҵڷ Ͽ ð, RSS, ȭ Ѵ.
+//    Ÿӽ Ͽ  忡  Ѵ.
+
+namespace
+{
+
+struct ReplayAllocator
+{
+    const char* Name;
+    void* (*Allocate)(std::size_t size);
+    void (*Deallocate)(void* ptr, std::size_t size);
+};
+
+const ReplayAllocator ALLOCATORS[] = {
+    {"tmp", [](std::size_t size) { return Detail::EngineAllocate(size); },
+     [](void* ptr, std::size_t size) { Detail::EngineDeallocate(ptr, size); }},
+    {"malloc", [](std::size_t size) { return std::malloc(size); }, [](void* ptr, std::size_t) { std::free(ptr); }},
+#if defined(TMP_HAVE_TBBMALLOC)
+    {"tbb", [](std::size_t size) { return scalable_malloc(size); },
+     [](void* ptr, std::size_t) { scalable_free(ptr); }},
+#endif
+};
+
+/// @brief  μ  ޸ (Byte).  ʴ ÷ 0.
+std::size_t GetCurrentRss()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters = {};
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+    return counters.WorkingSetSize;
+#elif defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    std::size_t totalPages = 0;
+    std::size_t residentPages = 0;
+    statm >> totalPages >> residentPages;
+    return residentPages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
+
+bool LoadTrace(const std::string& path, std::vector<TraceRecord>& records)
+{
+    std::ifstream file(path, std::ios::binary);
+    if(!file)
+    {
+        std::cerr << "Cannot open trace: " << path << std::endl;
+        return false;
+    }
+
+    TraceFileHeader header = {};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if(!file || header.Magic != TraceFileHeader::MAGIC || header.Version != TraceFileHeader::VERSION ||
+       header.RecordSize != sizeof(TraceRecord))
+    {
+        std::cerr << "Not a TinyMemoryPool trace (or incompatible version): " << path << std::endl;
+        return false;
+    }
+
+    TraceRecord record = {};
+    while(file.read(reinterpret_cast<char*>(&record), sizeof(record)))
+    {
+        records.push_back(record);
+    }
+
+    // Ͽ     Ƿ ð  
+    std::stable_sort(records.begin(), records.end(),
+                     [](const TraceRecord& a, const TraceRecord& b) { return a.TimestampNs < b.TimestampNs; });
+    return true;
+}
+
+void Replay(const ReplayAllocator& allocator, const std::vector<TraceRecord>& records)
+{
+    struct LiveBlock
+    {
+        void* Ptr;
+        std::size_t Size;
+    };
+
+    constexpr std::size_t RSS_SAMPLE_INTERVAL = 4096;
+    constexpr std::size_t MIN_LIVE_BYTES_FOR_RATIO = 1024 * 1024; ///< ̺  RSS   ¿Ѵ.
+
+    std::unordered_map<std::uint64_t, LiveBlock> liveBlocks;
+    liveBlocks.reserve(records.size() / 2 + 1);
+
+    std::size_t liveBytes = 0;
+    std::size_t peakLiveBytes = 0;
+    std::size_t unmatchedFrees = 0;
+    std::size_t duplicateIds = 0;
+
+    //  ʱȭ(Ǯ ʱ  Ŀ )   ʵ  RSS     Ҵ/
+    allocator.Deallocate(allocator.Allocate(64), 64);
+
+    const std::size_t baseRss = GetCurrentRss();
+    std::size_t peakRss = baseRss;
+    double elapsedMs = 0.0;
+
+    for(std::size_t i = 0; i < records.size(); ++i)
+    {
+        const TraceRecord& record = records[i];
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        if(record.Op == TraceOp::Allocate)
+        {
+            void* ptr = allocator.Allocate(static_cast<std::size_t>(record.Size));
+            if(ptr != nullptr)
+                std::memset(ptr, 0, std::min<std::size_t>(static_cast<std::size_t>(record.Size), 64)); //  ġ
+
+            const LiveBlock block = {ptr, static_cast<std::size_t>(record.Size)};
+
+            auto [it, isInserted] = liveBlocks.try_emplace(record.Id, block);
+            if(!isInserted)
+            {
+                //    Id (  Ÿӽ  ).   Ű ʵ   ü
+                ++duplicateIds;
+                allocator.Deallocate(it->second.Ptr, it->second.Size);
+                liveBytes -= it->second.Size;
+                it->second = block;
+            }
+
+            liveBytes += static_cast<std::size_t>(record.Size);
+            peakLiveBytes = std::max(peakLiveBytes, liveBytes);
+        }
+        else
+        {
+            auto it = liveBlocks.find(record.Id);
+            if(it == liveBlocks.end())
+            {
+                ++unmatchedFrees; //    Ҵ  
+                continue;
+            }
+
+            allocator.Deallocate(it->second.Ptr, it->second.Size);
+            liveBytes -= it->second.Size;
+            liveBlocks.erase(it);
+        }
+
+        const auto end = std::chrono::high_resolution_clock::now();
+        elapsedMs += std::chrono::duration<double, std::milli>(end - start).count();
+
+        if(i % RSS_SAMPLE_INTERVAL == 0)
+            peakRss = std::max(peakRss, GetCurrentRss());
+    }
+    peakRss = std::max(peakRss, GetCurrentRss());
+
+    for(auto& [id, block] : liveBlocks)
+    {
+        allocator.Deallocate(block.Ptr, block.Size);
+    }
+
+    // RSS   پ  Ƿ غ  0 
+    const double peakRssDeltaMb = static_cast<double>(std::max(peakRss, baseRss) - baseRss) / (1024.0 * 1024.0);
+    const double peakLiveMb = static_cast<double>(peakLiveBytes) / (1024.0 * 1024.0);
+
+    std::cout << std::left << std::setw(8) << allocator.Name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << elapsedMs << " ms" << std::setw(12) << peakLiveMb << " MB live" << std::setw(12)
+              << peakRssDeltaMb << " MB rss";
+    if(peakLiveBytes >= MIN_LIVE_BYTES_FOR_RATIO)
+        std::cout << std::setw(10) << (peakRssDeltaMb / peakLiveMb) << "x frag";
+    else
+        std::cout << std::setw(10) << "n/a" << "  frag";
+    if(unmatchedFrees > 0)
+        std::cout << "  (" << unmatchedFrees << " unmatched frees)";
+    if(duplicateIds > 0)
+        std::cout << "  (" << duplicateIds << " duplicate ids)";
+    std::cout << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if(argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <trace file> [tmp|malloc|tbb|all]" << std::endl;
+        return 1;
+    }
+
+    const std::string target = (argc >= 3) ? argv[2] : "all";
+
+    std::vector<TraceRecord> records;
+    if(!LoadTrace(argv[1], records))
+        return 1;
+
+    std::cout << "Replaying " << records.size() << " records from " << argv[1] << std::endl;
+    std::cout << "(RSS accumulates within one process; run each allocator separately for exact numbers)" << std::endl;
+
+    bool replayed = false;
+    for(const ReplayAllocator& allocator : ALLOCATORS)
+    {
+        if(target == "all" || target == allocator.Name)
+        {
+            Replay(allocator, records);
+            replayed = true;
+        }
+    }
+
+    if(!replayed)
+    {
+        std::cerr << "Unknown allocator: " << target << std::endl;
+        return 1;
+    }
+    return 0;
+}
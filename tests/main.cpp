@@ -1,10 +1,32 @@
+#include <atomic>
 #include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <list>
+#include <map>
 #include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include <TinyMemoryPool/Allocator.h>
+#include <TinyMemoryPool/Coroutine.h>
+#include <TinyMemoryPool/LocalityAllocator.h>
+#include <TinyMemoryPool/OffsetPtr.h>
+#include <TinyMemoryPool/PersistentHeap.h>
+#include <TinyMemoryPool/Reclaim.h>
+#include <TinyMemoryPool/SharedHeap.h>
+#include <TinyMemoryPool/ThreadingPolicy.h>
+#include <TinyMemoryPool/Trace.h>
 
 using namespace TinyMemoryPool;
 
@@ -25,6 +47,64 @@ class Timer
     }
 };
 
+/// @brief  Ҵ 񱳿 ڷƾ. PromiseBase ⺻ operator new / PooledPromise Ѵ.
+template <typename PromiseBase>
+struct BenchTask
+{
+    struct promise_type : PromiseBase
+    {
+        int value = 0;
+
+        BenchTask get_return_object()
+        {
+            return BenchTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+        void return_value(int v)
+        {
+            value = v;
+        }
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+struct DefaultPromise
+{
+};
+
+template <typename PromiseBase>
+BenchTask<PromiseBase> MakeFrame(int value)
+{
+    int local[16] = {value}; //  ũ⸦  񵿱 ڵ鷯  Ű
+    co_return local[0] + 1;
+}
+
+template <typename PromiseBase>
+long long RunFrames(int count)
+{
+    long long sum = 0;
+    for(int i = 0; i < count; ++i)
+    {
+        auto task = MakeFrame<PromiseBase>(i);
+        task.handle.resume();
+        sum += task.handle.promise().value;
+        task.handle.destroy();
+    }
+    return sum;
+}
+
 void TestFunctional()
 {
     std::cout << "=== 1. Functional Test (Address Check) ===" << std::endl;
@@ -44,9 +124,706 @@ void TestFunctional()
     std::cout << "-> If no crash, Allocator -> Bridge -> PoolManager works!" << std::endl << std::endl;
 }
 
+void TestMultiThreadChurn()
+{
+    std::cout << "=== 2. Multi-Thread Churn Test (All Size Classes) ===" << std::endl;
+
+    constexpr int THREAD_COUNT = 4;
+    constexpr int ROUND_COUNT = 20;
+    constexpr std::size_t BLOCK_COUNT = 4096;
+
+    std::vector<std::thread> threads;
+    std::vector<int> failures(THREAD_COUNT, 0);
+
+    for(int t = 0; t < THREAD_COUNT; ++t)
+    {
+        threads.emplace_back([t, &failures]() {
+            Allocator<unsigned char> alloc;
+            std::vector<std::pair<unsigned char*, std::size_t>> blocks;
+            blocks.reserve(BLOCK_COUNT);
+
+            for(int round = 0; round < ROUND_COUNT; ++round)
+            {
+                // 16B ~ 4000B:  ũ Ŭ ġ ũ⸦ ȯ
+                for(std::size_t i = 0; i < BLOCK_COUNT; ++i)
+                {
+                    const std::size_t size = 16 + (i * 61) % 3985;
+                    unsigned char* p = alloc.allocate(size);
+                    p[0] = p[size - 1] = static_cast<unsigned char>(t + i);
+                    blocks.emplace_back(p, size);
+                }
+
+                for(std::size_t i = 0; i < blocks.size(); ++i)
+                {
+                    auto [p, size] = blocks[i];
+                    const auto expected = static_cast<unsigned char>(t + i);
+                    if(p[0] != expected || p[size - 1] != expected)
+                        ++failures[t];
+                }
+
+                // Ȧ ° , ¦ °   Span/Free List ° ̵ 
+                for(std::size_t i = 1; i < blocks.size(); i += 2)
+                {
+                    alloc.deallocate(blocks[i].first, blocks[i].second);
+                }
+                for(std::size_t i = blocks.size() & ~std::size_t{1}; i >= 2;)
+                {
+                    i -= 2;
+                    alloc.deallocate(blocks[i].first, blocks[i].second);
+                }
+                blocks.clear();
+            }
+        });
+    }
+
+    for(auto& thread : threads)
+        thread.join();
+
+    for(int failure : failures)
+    {
+        if(failure != 0)
+            throw std::runtime_error("Multi-thread churn corrupted blocks");
+    }
+
+    std::cout << "-> " << THREAD_COUNT << " threads x " << ROUND_COUNT << " rounds x " << BLOCK_COUNT
+              << " blocks without corruption." << std::endl
+              << std::endl;
+}
+
+void TestReallocate()
+{
+    std::cout << "=== 3. Reallocate / TryExpand Test ===" << std::endl;
+
+    Allocator<int> alloc;
+
+    // 4 * 4B + Header 16B = 32B -> 64B ûũ.  ŭ count þ 
+    auto [ptr, count] = alloc.allocate_at_least(4);
+    std::cout << "allocate_at_least(4) -> count " << count << std::endl;
+    if(count < 4 || Detail::EngineGetUsableSize(ptr) != count * sizeof(int))
+        throw std::runtime_error("allocate_at_least returned wrong capacity");
+
+    for(std::size_t i = 0; i < count; ++i)
+        ptr[i] = static_cast<int>(i);
+
+    //  ûũ ȿ Ȯ ּҰ ٲ ʾƾ 
+    if(Detail::EngineTryExpand(ptr, count * sizeof(int)) == 0)
+        throw std::runtime_error("TryExpand failed within chunk");
+    if(Detail::EngineTryExpand(ptr, 4096) != 0)
+        throw std::runtime_error("TryExpand succeeded beyond chunk");
+
+    // Pool ûũ -> System Malloc  ̵ϸ  
+    auto* grown = static_cast<int*>(Detail::EngineReallocate(ptr, 8192 * sizeof(int)));
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        if(grown[i] != static_cast<int>(i))
+            throw std::runtime_error("Reallocate lost contents");
+    }
+
+    // System Malloc ϳ realloc 
+    grown = static_cast<int*>(Detail::EngineReallocate(grown, 65536 * sizeof(int)));
+    if(grown[count - 1] != static_cast<int>(count - 1))
+        throw std::runtime_error("Reallocate lost contents (large)");
+
+    alloc.deallocate(grown, 65536);
+    std::cout << "-> Reallocate keeps contents, TryExpand stays in chunk." << std::endl << std::endl;
+}
+
+void TestPersistentHeap()
+{
+    std::cout << "=== 4. Persistent Heap Test (Warm Restart) ===" << std::endl;
+
+    struct PersistentNode
+    {
+        int value;
+        OffsetPtr<PersistentNode> next;
+    };
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "TinyMemoryPool_Test.heap";
+    std::filesystem::remove(path);
+
+    const auto verifyList = [](const PersistentHeap& heap)
+    {
+        int expected = 999;
+        for(auto* node = static_cast<PersistentNode*>(heap.GetRoot()); node; node = node->next.Get())
+        {
+            if(node->value != expected--)
+                throw std::runtime_error("PersistentHeap lost contents");
+        }
+        if(expected != -1)
+            throw std::runtime_error("PersistentHeap lost nodes");
+    };
+
+    {
+        PersistentHeap heap;
+        if(!heap.Open(path.string(), 16 * 1024 * 1024) || heap.IsRecovered())
+            throw std::runtime_error("PersistentHeap failed to create a new file");
+
+        PersistentNode* head = nullptr;
+        for(int i = 0; i < 1000; ++i)
+        {
+            auto* node = static_cast<PersistentNode*>(heap.Allocate(sizeof(PersistentNode)));
+            node->value = i;
+            node->next = head;
+            head = node;
+        }
+        heap.SetRoot(head);
+        heap.Flush();
+
+        // ù   ּҸ ϰ Ƿ  °  ݵ ٸ ּҿ δ.
+        // OffsetPtr  Ʈ ġ ο ״  
+        PersistentHeap relocated;
+        if(!relocated.Open(path.string(), 0) || !relocated.IsRecovered())
+            throw std::runtime_error("PersistentHeap failed to recover");
+        if(!relocated.IsRelocated() || relocated.GetRoot() == heap.GetRoot())
+            throw std::runtime_error("PersistentHeap was not mapped at a different address");
+
+        verifyList(relocated);
+        std::cout << "Recovered 1000 nodes from a relocated mapping" << std::endl;
+    }
+
+    {
+        //     ٽ  Ǿ 
+        PersistentHeap heap;
+        if(!heap.Open(path.string(), 0) || !heap.IsRecovered())
+            throw std::runtime_error("PersistentHeap failed to recover");
+
+        verifyList(heap);
+
+        //  ũ⸦ ϸ ÷ϴ û   ƴ϶ nullptr̾ 
+        if(heap.Allocate(std::numeric_limits<std::size_t>::max() - 8) != nullptr)
+            throw std::runtime_error("PersistentHeap accepted an overflowing size");
+    }
+
+    {
+        //  ƴ   ʰ ״ ξ . Create   
+        const std::string text = "not a heap file\n";
+        {
+            std::ofstream victim(path, std::ios::binary | std::ios::trunc);
+            victim << text;
+        }
+
+        PersistentHeap heap;
+        if(heap.Open(path.string(), 4096) || heap.GetLastError() != PersistentHeapError::NotAHeap)
+            throw std::runtime_error("PersistentHeap opened a foreign file");
+        if(std::filesystem::file_size(path) != text.size())
+            throw std::runtime_error("PersistentHeap modified a foreign file");
+
+        if(!heap.Create(path.string(), 4096) || heap.IsRecovered())
+            throw std::runtime_error("PersistentHeap::Create failed to format the file");
+    }
+
+    //  Version ʵ(8° Ʈ) ٲ ٸ   䳻 
+    const auto writeVersion = [&path](std::uint32_t version)
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(8);
+        file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    };
+
+    // (1)/(99)   ǵ帮 ʰ ؾ 
+    for(const std::uint32_t version : {1u, 99u})
+    {
+        writeVersion(version);
+
+        PersistentHeap heap;
+        if(heap.Open(path.string(), 0) || heap.GetLastError() != PersistentHeapError::UnsupportedVersion)
+            throw std::runtime_error("PersistentHeap opened an unsupported version");
+    }
+
+    std::filesystem::remove(path);
+    std::cout << "-> Root and free lists survive a reopen; foreign files are left untouched." << std::endl
+              << std::endl;
+}
+
+void TestSharedHeap()
+{
+    std::cout << "=== 5. Shared Heap Test (Zero-Copy Handle) ===" << std::endl;
+
+#if defined(_WIN32)
+    const std::string name = "Local\\TinyMemoryPool_Test";
+#else
+    const std::string name = "/TinyMemoryPool_Test";
+#endif
+    SharedHeap::Unlink(name);
+
+    //  μ ȿ   ϸ  ٸ ּҰ ǹǷ, ٸ μ ѱ Ȳ 
+    SharedHeap producer;
+    SharedHeap consumer;
+    if(!producer.Create(name, 4 * 1024 * 1024) || !consumer.Open(name))
+        throw std::runtime_error("SharedHeap failed to create/open");
+
+    const char message[] = "zero-copy message";
+    void* sent = producer.Allocate(sizeof(message));
+    std::memcpy(sent, message, sizeof(message));
+
+    const SharedHandle handle = producer.ToHandle(sent);
+    auto* received = static_cast<const char*>(consumer.FromHandle(handle));
+    if(std::strcmp(received, message) != 0)
+        throw std::runtime_error("SharedHeap handle points to wrong data");
+
+    // Һڰ   ڰ ٽ ޾ƾ  ( Free List )
+    consumer.Deallocate(handle);
+    if(producer.Allocate(sizeof(message)) != sent)
+        throw std::runtime_error("SharedHeap free list is not shared");
+
+    std::cout << "Producer " << sent << " -> Consumer " << static_cast<const void*>(received) << std::endl;
+
+    consumer.Close();
+    producer.Close();
+    SharedHeap::Unlink(name);
+    std::cout << "-> Consumer frees back into the producer's pool." << std::endl << std::endl;
+}
+
+void TestTraceRecording()
+{
+    std::cout << "=== 6. Trace Recording Test ===" << std::endl;
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "TinyMemoryPool_Test.trace";
+
+    if(!StartTraceRecording(path.string()))
+    {
+        std::cout << "-> Trace recording is disabled (configure with -DTMP_ENABLE_TRACE=ON)." << std::endl
+                  << std::endl;
+        return;
+    }
+
+    constexpr std::size_t OP_PAIRS = 10000;
+    {
+        Allocator<int> alloc;
+        for(std::size_t i = 0; i < OP_PAIRS; ++i)
+        {
+            int* p = alloc.allocate(1 + i % 100);
+            alloc.deallocate(p, 1 + i % 100);
+        }
+    }
+    StopTraceRecording();
+
+    const auto expectedSize = sizeof(TraceFileHeader) + OP_PAIRS * 2 * sizeof(TraceRecord);
+    const auto fileSize = std::filesystem::file_size(path);
+    std::cout << "Trace: " << path.string() << " (" << fileSize << " bytes)" << std::endl;
+    if(fileSize < expectedSize)
+        throw std::runtime_error("Trace is missing records");
+
+    std::cout << "-> Replay with: TMP_TraceReplay " << path.string() << std::endl << std::endl;
+}
+
+void TestLocalityAllocator()
+{
+    std::cout << "=== 7. Locality-Hinted Allocation Test ===" << std::endl;
+
+    constexpr int NODE_COUNT = 10000;
+
+    //  hint:   ¿ hint ó Ҵ  ġ ʴ Ȯ
+    // (  Free List Ŭ̹Ƿ hint õȴ.   ġ TMP_SlabTest )
+    {
+        LocalityAllocator<long long> alloc;
+        std::vector<long long*> fillers;
+        for(int i = 0; i < NODE_COUNT; ++i)
+            fillers.push_back(alloc.allocate(1, nullptr));
+        for(std::size_t i = 1; i < fillers.size(); i += 2)
+            alloc.deallocate(fillers[i], 1);
+
+        const long long* parent = fillers[NODE_COUNT / 2];
+        std::vector<long long*> children;
+        for(int i = 0; i < 16; ++i)
+        {
+            long long* child = alloc.allocate(1, parent);
+            *child = i;
+            children.push_back(child);
+        }
+
+        for(int i = 0; i < 16; ++i)
+        {
+            if(*children[static_cast<std::size_t>(i)] != i)
+                throw std::runtime_error("AllocateNear returned overlapping nodes");
+            alloc.deallocate(children[static_cast<std::size_t>(i)], 1);
+        }
+        for(std::size_t i = 0; i < fillers.size(); i += 2)
+            alloc.deallocate(fillers[i], 1);
+    }
+
+    // Ͻ hint:   ̳ʿ   ó ġ
+    {
+        std::map<int, int, std::less<int>, LocalityAllocator<std::pair<const int, int>>> index;
+        for(int i = 0; i < NODE_COUNT; ++i)
+            index.emplace((i * 7919) % NODE_COUNT, i);
+
+        auto copy = index;
+        for(int i = 0; i < NODE_COUNT; i += 2)
+            index.erase(i);
+
+        int expected = 0;
+        for(const auto& [key, value] : copy)
+        {
+            if(key != expected++ || (value * 7919) % NODE_COUNT != key)
+                throw std::runtime_error("LocalityAllocator map lost contents");
+        }
+        if(index.size() != NODE_COUNT / 2 || index.begin()->first != 1)
+            throw std::runtime_error("LocalityAllocator map erase failed");
+    }
+
+    std::cout << "-> Hinted allocations stay valid; std::map works with LocalityAllocator." << std::endl << std::endl;
+}
+
+void TestEpochReclamation()
+{
+    std::cout << "=== 8. Epoch-Based Reclamation Test ===" << std::endl;
+
+    struct StackNode
+    {
+        std::uint64_t magic;
+        int value;
+        StackNode* next;
+    };
+
+    constexpr std::uint64_t LIVE_MAGIC = 0x45444F4E4556494C; // "LIVENODE"
+    constexpr int OP_COUNT = 200000;
+    constexpr int MAX_DEPTH = 32;
+    constexpr int READER_COUNT = 2;
+
+    Allocator<StackNode> alloc;
+
+    // 1) ٸ 尡 带  ִ ȿ ȸ ʰ, 带  ȸǾ 
+    {
+        std::atomic<int> phase = 0;
+        std::thread holder([&phase]() {
+            EpochGuard guard;
+            phase.store(1, std::memory_order_release);
+            while(phase.load(std::memory_order_acquire) != 2)
+                std::this_thread::yield();
+        });
+        while(phase.load(std::memory_order_acquire) != 1)
+            std::this_thread::yield();
+
+        Retire(alloc.allocate(1), sizeof(StackNode));
+        const std::size_t pendingWhileHeld = TryReclaim();
+
+        phase.store(2, std::memory_order_release);
+        holder.join();
+
+        const std::size_t pendingAfterRelease = TryReclaim();
+        std::cout << "Pending while guarded: " << pendingWhileHeld << ", after release: " << pendingAfterRelease
+                  << std::endl;
+        if(pendingWhileHeld == 0 || pendingAfterRelease != 0)
+            throw std::runtime_error("Retire did not wait for the guarded reader");
+    }
+
+    // 2) б 尡  ȸϴ ÿ pop 带 Retire
+    std::atomic<StackNode*> head = nullptr;
+    std::atomic<bool> done = false;
+    std::atomic<int> corrupted = 0;
+
+    // б :  ȿ    ȸ ʾƾ 
+    std::vector<std::thread> readers;
+    for(int r = 0; r < READER_COUNT; ++r)
+    {
+        readers.emplace_back([&]() {
+            while(!done.load(std::memory_order_acquire))
+            {
+                EpochGuard guard;
+                StackNode* top = head.load(std::memory_order_acquire);
+
+                // 带  ä  ӹ ݺ ˻.    尡 pop/  ݺѴ
+                const auto holdUntil = std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
+                do
+                {
+                    int depth = 0;
+                    for(StackNode* node = top; node && depth < MAX_DEPTH; node = node->next, ++depth)
+                    {
+                        //   next  ʴ´
+                        if(node->magic != LIVE_MAGIC)
+                        {
+                            corrupted.fetch_add(1, std::memory_order_relaxed);
+                            break;
+                        }
+                    }
+                } while(std::chrono::steady_clock::now() < holdUntil);
+            }
+        });
+    }
+
+    //   (): push/pop  Retire. ʹ  ȸ    ȸ   ȴ
+    // (Free List Pool FIFO 븸δ ʰ 巯Ƿ, LIFO ϴ   TMP_SlabTest )
+    std::vector<StackNode*> scribbles(1024, nullptr);
+    std::size_t scribbleIndex = 0;
+
+    for(int i = 0; i < OP_COUNT; ++i)
+    {
+        StackNode* node = alloc.allocate(1);
+        *node = StackNode{LIVE_MAGIC, i, head.load(std::memory_order_relaxed)};
+        head.store(node, std::memory_order_release);
+
+        if((i + 1) % MAX_DEPTH != 0)
+            continue;
+
+        //  ֱ , б 尡  ִ 嵵   
+        while(StackNode* top = head.load(std::memory_order_relaxed))
+        {
+            head.store(top->next, std::memory_order_release);
+            Retire(top, sizeof(StackNode));
+
+            // ݳ ûũ   Ҵ   
+            StackNode*& scribble = scribbles[scribbleIndex++ % scribbles.size()];
+            if(scribble)
+                alloc.deallocate(scribble, 1);
+            scribble = alloc.allocate(1);
+            std::memset(scribble, 0, sizeof(StackNode));
+        }
+    }
+
+    for(StackNode* scribble : scribbles)
+    {
+        if(scribble)
+            alloc.deallocate(scribble, 1);
+    }
+
+    done.store(true, std::memory_order_release);
+    for(auto& reader : readers)
+        reader.join();
+
+    for(StackNode* node = head.exchange(nullptr); node;)
+    {
+        StackNode* next = node->next;
+        Retire(node, sizeof(StackNode));
+        node = next;
+    }
+
+    const std::size_t pending = TryReclaim();
+    std::cout << "Corrupted reads: " << corrupted.load() << ", pending after reclaim: " << pending << std::endl;
+
+    if(corrupted.load() != 0)
+        throw std::runtime_error("Retired node was reclaimed while a reader held it");
+    if(pending != 0)
+        throw std::runtime_error("Retired nodes were not reclaimed after readers left");
+
+    std::cout << "-> Readers never saw a recycled node; all retired nodes returned to the pool." << std::endl
+              << std::endl;
+}
+
+/// @brief ٸ    Ȯο ڽ μ .  忡 TMP_ASSERT ߴܵǾ Ѵ.
+int RunWrongThread(const std::string& mode)
+{
+    if(mode == "--wrong-thread-allocator")
+    {
+        //  忡  Allocator ٸ 忡 
+        Allocator<int, SingleThreaded> alloc;
+        std::thread([&alloc]() { alloc.deallocate(alloc.allocate(4), 4); }).join();
+    }
+    else
+    {
+        // Heap Allocator νϽ ˻簡 Ƿ   ûũ  ˻縸 ƾ 
+        void* p = Heap<SingleThreaded>::Allocate(48);
+        std::thread([p]() { Heap<SingleThreaded>::Deallocate(p, 48); }).join();
+    }
+
+    std::cerr << "Wrong-thread use was not detected (" << mode << ")" << std::endl;
+    return 0;
+}
+
+void TestSingleThreadedHeap(const char* selfPath)
+{
+    std::cout << "=== 9. SingleThreaded Heap (Lock-free, Atomic-free) ===" << std::endl;
+
+    using LocalAlloc = Allocator<int, SingleThreaded>;
+
+    {
+        std::vector<int, LocalAlloc> v;
+        std::list<int, LocalAlloc> l;
+        for(int i = 0; i < 10000; ++i)
+        {
+            v.push_back(i);
+            l.push_back(i);
+        }
+
+        long long vectorSum = 0;
+        long long listSum = 0;
+        for(int x : v)
+            vectorSum += x;
+        for(int x : l)
+            listSum += x;
+
+        if(vectorSum != 49995000LL || listSum != 49995000LL)
+            throw std::runtime_error("SingleThreaded containers lost data");
+    }
+
+    {
+        LocalAlloc alloc;
+
+        auto [ptr, count] = alloc.allocate_at_least(10);
+        if(ptr == nullptr || count < 10)
+            throw std::runtime_error("SingleThreaded allocate_at_least failed");
+        ptr[count - 1] = 42;
+        alloc.deallocate(ptr, count);
+
+        // ũ Ŭ (4KB) Ѵ û System Malloc 
+        int* large = alloc.allocate(4096);
+        large[4095] = 7;
+        alloc.deallocate(large, 4096);
+
+        //  ûũ  ũ Ŭ  û ״ ȴ (LIFO)
+        int* first = alloc.allocate(16);
+        alloc.deallocate(first, 16);
+        int* second = alloc.allocate(16);
+        if(first != second)
+            throw std::runtime_error("SingleThreaded free list did not reuse the released chunk");
+        alloc.deallocate(second, 16);
+    }
+
+    {
+        void* raw = Heap<SingleThreaded>::Allocate(48);
+        std::memset(raw, 0xAB, 48);
+        Heap<SingleThreaded>::Deallocate(raw, 48);
+
+        if(Allocator<int>() == LocalAlloc())
+            throw std::runtime_error("Allocators with different threading policies compared equal");
+    }
+
+    //   ûũ   ,  ũ Ŭ ó  ٸ 尡  ޾ 
+    {
+        constexpr std::size_t CHUNK_COUNT = 64;
+        constexpr std::size_t CHUNK_SIZE = 1000; // 1KB Ŭ ( ׽Ʈ ٸ   )
+
+        std::set<void*> exitedChunks;
+        std::thread(
+            [&exitedChunks]()
+            {
+                std::vector<void*> chunks;
+                for(std::size_t i = 0; i < CHUNK_COUNT; ++i)
+                    chunks.push_back(Heap<SingleThreaded>::Allocate(CHUNK_SIZE));
+                for(void* chunk : chunks)
+                {
+                    exitedChunks.insert(chunk);
+                    Heap<SingleThreaded>::Deallocate(chunk, CHUNK_SIZE);
+                }
+            })
+            .join();
+
+        std::size_t reused = 0;
+        std::thread(
+            [&exitedChunks, &reused]()
+            {
+                std::vector<void*> chunks;
+                for(std::size_t i = 0; i < CHUNK_COUNT; ++i)
+                {
+                    chunks.push_back(Heap<SingleThreaded>::Allocate(CHUNK_SIZE));
+                    reused += exitedChunks.count(chunks.back());
+                }
+                for(void* chunk : chunks)
+                    Heap<SingleThreaded>::Deallocate(chunk, CHUNK_SIZE);
+            })
+            .join();
+
+        std::cout << "Chunks reused from an exited thread: " << reused << " / " << CHUNK_COUNT << std::endl;
+        if(reused != CHUNK_COUNT)
+            throw std::runtime_error("Chunks of an exited thread were not returned through the orphan lists");
+    }
+
+    // 帶 ڽ  .   ûũ ٸ 尡   ֵ ȯȴ
+    std::vector<std::thread> workers;
+    std::atomic<bool> failed = false;
+    for(int t = 0; t < 4; ++t)
+    {
+        workers.emplace_back(
+            [&failed, t]()
+            {
+                std::vector<int, LocalAlloc> v;
+                std::list<int, LocalAlloc> l;
+                for(int i = 0; i < 5000; ++i)
+                {
+                    v.push_back(i * t);
+                    l.push_back(i * t);
+                }
+
+                if(v.back() != 4999 * t || l.back() != 4999 * t)
+                    failed = true;
+            });
+    }
+    for(auto& worker : workers)
+        worker.join();
+
+    if(failed)
+        throw std::runtime_error("SingleThreaded worker heaps corrupted data");
+
+    //      Ҹ (ٸ TLS Ҹ) Ҵ/   óǾ 
+    struct LateHeapUser
+    {
+        ~LateHeapUser()
+        {
+            void* p = Heap<SingleThreaded>::Allocate(48);
+            std::memset(p, 0xCD, 48);
+            Heap<SingleThreaded>::Deallocate(p, 48);
+        }
+    };
+
+    std::thread(
+        []()
+        {
+            thread_local LateHeapUser lateUser; //   ǹǷ ߿ Ҹ
+            (void) &lateUser;
+
+            void* p = Heap<SingleThreaded>::Allocate(48);
+            Heap<SingleThreaded>::Deallocate(p, 48);
+        })
+        .join();
+
+    // ٸ    忡 ߴܵǾ ϹǷ ڽ μ Ȯ
+#if TMP_ASSERT_ENABLED
+    for(const char* mode : {"--wrong-thread-allocator", "--wrong-thread-free"})
+    {
+        const std::string command = std::string("\"") + selfPath + "\" " + mode;
+        if(std::system(command.c_str()) == 0)
+            throw std::runtime_error(std::string("Wrong-thread use was not detected: ") + mode);
+    }
+    std::cout << "Wrong-thread allocator use and cross-thread free abort in debug builds." << std::endl;
+#else
+    (void) selfPath;
+#endif
+
+    std::cout << "-> Containers, raw Heap, and per-thread heaps work without shared state." << std::endl
+              << std::endl;
+}
+
+void TestCoroutineFrames()
+{
+    std::cout << "=== 10. Coroutine Frame Cache Test ===" << std::endl;
+
+    //    Ŷ  Ҵ翡 ״ ȴ
+    void* first = Detail::EngineAllocateFrame(40);
+    Detail::EngineDeallocateFrame(first, 40);
+    void* second = Detail::EngineAllocateFrame(48);
+    if(first != second)
+        throw std::runtime_error("Frame cache did not reuse the released frame");
+    Detail::EngineDeallocateFrame(second, 48);
+
+    // Ŷ  ÷  ũⰡ  Pool Ŭ  ʾƾ  (64B, 128B Ŭ)
+    for(const auto [size, usable] : {std::pair<std::size_t, std::size_t>{48, 48}, {100, 112}})
+    {
+        void* frame = Detail::EngineAllocateFrame(size);
+        const std::size_t actual = Detail::EngineGetUsableSize(frame);
+        Detail::EngineDeallocateFrame(frame, size);
+
+        if(actual != usable)
+            throw std::runtime_error("Frame rounding spilled into a larger size class");
+    }
+
+    // ٸ 忡 Ҵ  ⼭ ϸ,  Ŷ  ū  û ״   ־ 
+    void* foreign = nullptr;
+    std::thread([&foreign]() { foreign = Detail::EngineAllocateFrame(180); }).join();
+    Detail::EngineDeallocateFrame(foreign, 180);
+
+    void* reused = Detail::EngineAllocateFrame(200);
+    if(reused != foreign)
+        throw std::runtime_error("Frame freed on another thread was not cached by the freeing thread");
+    std::memset(reused, 0x5A, 200);
+    Detail::EngineDeallocateFrame(reused, 200);
+
+    std::cout << "-> Frames are reused per bucket, stay in their size class, and move across threads." << std::endl
+              << std::endl;
+}
+
 void TestBenchmark()
 {
-    std::cout << "=== 2. Benchmark (std vs TinyMemoryPool) ===" << std::endl;
+    std::cout << "=== 11. Benchmark (std vs TinyMemoryPool) ===" << std::endl;
     const int ITEM_COUNT = 1'000'000; // 100 
 
     {
@@ -91,13 +868,53 @@ void TestBenchmark()
             alloc.deallocate(p, 1);
         }
     }
+
+    {
+        Timer t("TinyMemoryPool SingleThreaded Allocate/Deallocate");
+        Allocator<Node, SingleThreaded> alloc;
+        for(int i = 0; i < ITEM_COUNT; ++i)
+        {
+            Node* p = alloc.allocate(1);
+            alloc.deallocate(p, 1);
+        }
+    }
+
+    std::cout << "\n--- Coroutine Frame Allocation ---" << std::endl;
+
+    long long defaultSum = 0;
+    long long pooledSum = 0;
+
+    {
+        Timer t("Default operator new (coroutine frame)");
+        defaultSum = RunFrames<DefaultPromise>(ITEM_COUNT);
+    }
+
+    {
+        Timer t("TinyMemoryPool PooledPromise (coroutine frame)");
+        pooledSum = RunFrames<PooledPromise>(ITEM_COUNT);
+    }
+
+    if(defaultSum != pooledSum)
+        throw std::runtime_error("Pooled coroutine frames produced a different result");
 }
 
-int main()
+int main(int argc, char** argv)
 {
+    if(argc >= 2 && std::string(argv[1]).starts_with("--wrong-thread"))
+        return RunWrongThread(argv[1]);
+
     try
     {
         TestFunctional();
+        TestMultiThreadChurn();
+        TestReallocate();
+        TestPersistentHeap();
+        TestSharedHeap();
+        TestTraceRecording();
+        TestLocalityAllocator();
+        TestEpochReclamation();
+        TestSingleThreadedHeap(argv[0]);
+        TestCoroutineFrames();
         TestBenchmark();
     }
     catch(const std::exception& e)